@@ -0,0 +1,46 @@
+#include "AccountRegistry.h"
+#include <mutex>
+
+AccountHandle AccountRegistry::intern(const std::string& accountNumber) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = handles.find(accountNumber);
+    if (it != handles.end()) {
+        return it->second;
+    }
+
+    AccountHandle handle = (AccountHandle)numbers.size();
+    numbers.push_back(accountNumber);
+    handles.emplace(accountNumber, handle);
+    return handle;
+}
+
+AccountHandle AccountRegistry::find(const std::string& accountNumber) const {
+    if (accountNumber.empty()) {
+        return NO_ACCOUNT;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = handles.find(accountNumber);
+    if (it != handles.end()) {
+        return it->second;
+    }
+    return NO_ACCOUNT;
+}
+
+const std::string& AccountRegistry::numberOf(AccountHandle handle) const {
+    static const std::string none;
+    if (handle == NO_ACCOUNT) {
+        return none;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (handle >= numbers.size()) {
+        return none;
+    }
+    return numbers[handle];
+}
+
+size_t AccountRegistry::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return numbers.size();
+}
\ No newline at end of file
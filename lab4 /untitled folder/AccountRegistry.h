@@ -0,0 +1,40 @@
+#pragma once
+#ifndef ACCOUNTREGISTRY_H
+#define ACCOUNTREGISTRY_H
+
+#include <cstdint>
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+
+// Identifiant compact d'un compte dans une banque (indice d'ouverture)
+using AccountHandle = uint32_t;
+const AccountHandle NO_ACCOUNT = 0xFFFFFFFFu;
+
+// Table d'internement numéro de compte <-> handle.
+// Les numéros ne servent qu'aux entrées/sorties; le reste utilise les handles.
+class AccountRegistry {
+private:
+    std::deque<std::string> numbers;   // références stables
+    std::unordered_map<std::string, AccountHandle> handles;
+    mutable std::shared_mutex mutex;
+
+public:
+    AccountRegistry() = default;
+    AccountRegistry(const AccountRegistry&) = delete;
+    AccountRegistry& operator=(const AccountRegistry&) = delete;
+
+    // Retourne le handle existant ou en attribue un nouveau (0, 1, 2...)
+    AccountHandle intern(const std::string& accountNumber);
+
+    // NO_ACCOUNT si le numéro est inconnu ou vide
+    AccountHandle find(const std::string& accountNumber) const;
+
+    // Chaîne vide pour NO_ACCOUNT
+    const std::string& numberOf(AccountHandle handle) const;
+
+    size_t size() const;
+};
+
+#endif // ACCOUNTREGISTRY_H
\ No newline at end of file
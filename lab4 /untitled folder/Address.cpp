@@ -0,0 +1,61 @@
+#include "Address.h"
+#include <iostream>
+
+// Constructeurs
+Address::Address() {
+}
+
+Address::Address(const std::string& street, const std::string& city,
+    const std::string& postalCode, const std::string& country)
+    : street(street), city(city), postalCode(postalCode), country(country) {
+}
+
+// Getters
+const std::string& Address::getStreet() const {
+    return street;
+}
+
+const std::string& Address::getCity() const {
+    return city;
+}
+
+const std::string& Address::getPostalCode() const {
+    return postalCode;
+}
+
+const std::string& Address::getCountry() const {
+    return country;
+}
+
+// Setters
+void Address::setStreet(const std::string& street) {
+    this->street = street;
+}
+
+void Address::setCity(const std::string& city) {
+    this->city = city;
+}
+
+void Address::setPostalCode(const std::string& postalCode) {
+    this->postalCode = postalCode;
+}
+
+void Address::setCountry(const std::string& country) {
+    this->country = country;
+}
+
+// Affichage
+std::string Address::toString() const {
+    std::string result = street;
+    if (!postalCode.empty() || !city.empty()) {
+        result += ", " + postalCode + (postalCode.empty() || city.empty() ? "" : " ") + city;
+    }
+    if (!country.empty()) {
+        result += ", " + country;
+    }
+    return result;
+}
+
+void Address::display() const {
+    std::cout << "Adresse: " << toString() << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef ADDRESS_H
+#define ADDRESS_H
+
+#include <string>
+
+// Adresse postale d'un client
+class Address {
+private:
+    std::string street;
+    std::string city;
+    std::string postalCode;
+    std::string country;
+
+public:
+    // Constructeurs
+    Address();
+    Address(const std::string& street, const std::string& city,
+        const std::string& postalCode, const std::string& country);
+
+    // Getters
+    const std::string& getStreet() const;
+    const std::string& getCity() const;
+    const std::string& getPostalCode() const;
+    const std::string& getCountry() const;
+
+    // Setters
+    void setStreet(const std::string& street);
+    void setCity(const std::string& city);
+    void setPostalCode(const std::string& postalCode);
+    void setCountry(const std::string& country);
+
+    // Affichage
+    std::string toString() const;
+    void display() const;
+};
+
+#endif // ADDRESS_H
\ No newline at end of file
@@ -1,83 +1,474 @@
 #include "Bank.h"
+#include "EventSink.h"
 #include <algorithm>
+#include <bit>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <cassert>
+
+namespace {
+
+// Type d'enregistrement du journal d'une transaction
+JournalRecordType journalTypeOf(TransactionType type) {
+    switch (type) {
+    case TransactionType::DEPOSIT: return JournalRecordType::DEPOSIT;
+    case TransactionType::WITHDRAWAL: return JournalRecordType::WITHDRAWAL;
+    case TransactionType::TRANSFER: return JournalRecordType::TRANSFER;
+    case TransactionType::OPEN_ACCOUNT: return JournalRecordType::OPEN_ACCOUNT;
+    case TransactionType::CLOSE_ACCOUNT: return JournalRecordType::CLOSE_ACCOUNT;
+    case TransactionType::INTEREST: return JournalRecordType::INTEREST;
+    case TransactionType::FEE: return JournalRecordType::FEE;
+    default: return JournalRecordType::NONE;
+    }
+}
+
+// Le journal garde les dates sous forme AAAAMMJJ; le magasin, en numéro de jour
+int32_t journalDateOf(int32_t dayNumber) {
+    Date date = Date::fromDayNumber(dayNumber);
+    return date.getYear() * 10000 + date.getMonth() * 100 + date.getDay();
+}
+
+Date dateOf(int32_t journalDate) {
+    return Date(journalDate % 100, (journalDate / 100) % 100, journalDate / 10000);
+}
+
+int32_t dayNumberOf(int32_t journalDate) {
+    return dateOf(journalDate).toDayNumber();
+}
+
+// Codes stables des rapports CSV et JSON (les libellés affichés sont traduits)
+const char* accountTypeCode(AccountType type) {
+    return type == AccountType::SAVINGS ? "SAVINGS" : "CHECKING";
+}
+
+const char* accountStatusCode(AccountStatus status) {
+    switch (status) {
+    case AccountStatus::ACTIVE: return "ACTIVE";
+    case AccountStatus::CLOSED: return "CLOSED";
+    case AccountStatus::FROZEN: return "FROZEN";
+    default: return "UNKNOWN";
+    }
+}
+
+const char* transactionTypeCode(TransactionType type) {
+    switch (type) {
+    case TransactionType::DEPOSIT: return "DEPOSIT";
+    case TransactionType::WITHDRAWAL: return "WITHDRAWAL";
+    case TransactionType::TRANSFER: return "TRANSFER";
+    case TransactionType::OPEN_ACCOUNT: return "OPEN_ACCOUNT";
+    case TransactionType::CLOSE_ACCOUNT: return "CLOSE_ACCOUNT";
+    case TransactionType::INTEREST: return "INTEREST";
+    case TransactionType::FEE: return "FEE";
+    default: return "UNKNOWN";
+    }
+}
+
+// Numéros de tous les comptes, lus une fois: les threads du rapport ne
+// prennent pas le verrou du registre à chaque ligne
+std::vector<std::string_view> collectAccountNumbers(const AccountRegistry& registry) {
+    std::vector<std::string_view> numbers(registry.size());
+    for (size_t handle = 0; handle < numbers.size(); handle++) {
+        numbers[handle] = registry.numberOf((AccountHandle)handle);
+    }
+    return numbers;
+}
+
+std::string_view numberOf(const std::vector<std::string_view>& numbers, AccountHandle handle) {
+    return handle < numbers.size() ? numbers[handle] : std::string_view();
+}
+
+// Séparateur avant la ligne row d'un tableau JSON
+void beginJsonRow(ReportBuffer& buffer, size_t row) {
+    buffer.append(row == 0 ? "\n" : ",\n");
+}
+
+// Champs d'un compte (l'appelant tient le verrou du compte si nécessaire)
+void appendAccountFields(ReportBuffer& buffer, const BankAccount& account,
+    std::string_view number, ReportFormat format) {
+    if (format == ReportFormat::CSV) {
+        buffer.appendText(number, format);
+        buffer.append(',');
+        buffer.appendInt(account.getClientId());
+        buffer.append(',');
+        buffer.append(accountTypeCode(account.getType()));
+        buffer.append(',');
+        buffer.append(accountStatusCode(account.getStatus()));
+        buffer.append(',');
+        buffer.appendMoney(account.getBalance().getCents());
+        return;
+    }
+    buffer.append("\"number\":");
+    buffer.appendText(number, format);
+    buffer.append(",\"clientId\":");
+    buffer.appendInt(account.getClientId());
+    buffer.append(",\"type\":\"");
+    buffer.append(accountTypeCode(account.getType()));
+    buffer.append("\",\"status\":\"");
+    buffer.append(accountStatusCode(account.getStatus()));
+    buffer.append("\",\"balance\":");
+    buffer.appendMoney(account.getBalance().getCents());
+}
+
+// Champs d'une transaction, lus directement dans les colonnes du magasin
+void appendTransactionFields(ReportBuffer& buffer, const TransactionStore& store, size_t row,
+    const std::vector<std::string_view>& numbers, ReportFormat format) {
+    if (format == ReportFormat::CSV) {
+        buffer.appendInt(store.getId(row));
+        buffer.append(',');
+        buffer.appendDate(store.getDate(row));
+        buffer.append(',');
+        buffer.append(transactionTypeCode(store.getType(row)));
+        buffer.append(',');
+        buffer.appendText(numberOf(numbers, store.getFromAccount(row)), format);
+        buffer.append(',');
+        buffer.appendText(numberOf(numbers, store.getToAccount(row)), format);
+        buffer.append(',');
+        buffer.appendMoney(store.getAmount(row).getCents());
+        return;
+    }
+    buffer.append("\"id\":");
+    buffer.appendInt(store.getId(row));
+    buffer.append(",\"date\":\"");
+    buffer.appendDate(store.getDate(row));
+    buffer.append("\",\"type\":\"");
+    buffer.append(transactionTypeCode(store.getType(row)));
+    buffer.append("\",\"from\":");
+    buffer.appendText(numberOf(numbers, store.getFromAccount(row)), format);
+    buffer.append(",\"to\":");
+    buffer.appendText(numberOf(numbers, store.getToAccount(row)), format);
+    buffer.append(",\"amount\":");
+    buffer.appendMoney(store.getAmount(row).getCents());
+}
+
+// Relevé d'un compte: en CSV une ligne par transaction (une ligne sans
+// transaction si l'historique est vide), en JSON un objet
+void appendStatement(ReportBuffer& buffer, const BankAccount& account,
+    const std::pmr::vector<size_t>& positions, const TransactionStore& store,
+    const std::vector<std::string_view>& numbers, ReportFormat format) {
+    std::string_view number = numberOf(numbers, account.getHandle());
+    if (format == ReportFormat::CSV) {
+        for (size_t position : positions) {
+            appendAccountFields(buffer, account, number, format);
+            buffer.append(',');
+            appendTransactionFields(buffer, store, position, numbers, format);
+            buffer.append('\n');
+        }
+        if (positions.empty()) {
+            appendAccountFields(buffer, account, number, format);
+            buffer.append(",,,,,,\n");
+        }
+        return;
+    }
+    buffer.append('{');
+    appendAccountFields(buffer, account, number, format);
+    buffer.append(",\"transactions\":[");
+    for (size_t i = 0; i < positions.size(); i++) {
+        buffer.append(i == 0 ? "{" : ",{");
+        appendTransactionFields(buffer, store, positions[i], numbers, format);
+        buffer.append('}');
+    }
+    buffer.append("]}");
+}
+
+const char* const CLIENTS_CSV_HEADER = "id,type,first_name,last_name,accounts\n";
+const char* const ACCOUNTS_CSV_HEADER = "number,client_id,type,status,balance\n";
+const char* const TRANSACTIONS_CSV_HEADER = "id,date,type,from,to,amount\n";
+const char* const STATEMENTS_CSV_HEADER = "number,client_id,account_type,status,balance,"
+    "transaction_id,date,transaction_type,from,to,amount\n";
+
+}
 
 // Constructeur
 Bank::Bank(const std::string& name, const std::string& bankCode)
-    : name(name), bankCode(bankCode) {
+    : name(name), bankCode(bankCode), pools(std::make_shared<EntityPools>()),
+    transactions(&registry), clientMap(&indexPool), clientAccountIndex(&indexPool),
+    threadSafe(false),
+    snapshotEpoch(0), snapshotAccounts(0), snapshotRunning(false), snapshotResult(false),
+    statisticsCheck(false) {
+}
+
+// Destructeur: les pools survivent à la banque tant qu'un objet partagé existe
+Bank::~Bank() {
+    waitSnapshot();
+    for (const auto& account : accounts) {
+        account->setObserver(nullptr);
+    }
+    for (const auto& client : clients) {
+        client->setObserver(nullptr);
+    }
 }
 
 // M�thodes priv�es
-bool Bank::validateTransaction(const std::string& fromAccount,
-    const std::string& toAccount,
-    double amount) const {
-    // Validation de base
-    if (amount <= 0) {
-        std::cout << "Le montant doit �tre positif!" << std::endl;
-        return false;
+std::shared_lock<std::shared_mutex> Bank::readLock() const {
+    if (!threadSafe) {
+        return std::shared_lock<std::shared_mutex>(structureMutex, std::defer_lock);
     }
+    return std::shared_lock<std::shared_mutex>(structureMutex);
+}
 
-    // V�rifier si le compte source existe
-    auto fromAcc = findAccount(fromAccount);
-    if (!fromAcc) {
-        std::cout << "Compte source non trouv�!" << std::endl;
-        return false;
+std::unique_lock<std::shared_mutex> Bank::writeLock() const {
+    if (!threadSafe) {
+        return std::unique_lock<std::shared_mutex>(structureMutex, std::defer_lock);
     }
+    return std::unique_lock<std::shared_mutex>(structureMutex);
+}
 
-    // V�rifier si le compte destinataire existe (sauf pour les retraits)
-    auto toAcc = findAccount(toAccount);
-    if (toAccount != "" && !toAcc) {
-        std::cout << "Compte destinataire non trouv�!" << std::endl;
-        return false;
+std::shared_lock<std::shared_mutex> Bank::bitmapReadLock() const {
+    if (!threadSafe) {
+        return std::shared_lock<std::shared_mutex>(bitmapMutex, std::defer_lock);
     }
+    return std::shared_lock<std::shared_mutex>(bitmapMutex);
+}
 
-    // V�rifier le statut des comptes
-    if (!fromAcc->isActive()) {
-        std::cout << "Le compte source n'est pas actif!" << std::endl;
-        return false;
+std::unique_lock<std::shared_mutex> Bank::bitmapWriteLock() const {
+    if (!threadSafe) {
+        return std::unique_lock<std::shared_mutex>(bitmapMutex, std::defer_lock);
     }
+    return std::unique_lock<std::shared_mutex>(bitmapMutex);
+}
 
-    if (toAcc && !toAcc->isActive()) {
-        std::cout << "Le compte destinataire n'est pas actif!" << std::endl;
-        return false;
+std::unique_lock<std::mutex> Bank::lockAccount(const BankAccount& account) const {
+    if (!threadSafe) {
+        return std::unique_lock<std::mutex>(account.getMutex(), std::defer_lock);
+    }
+    return std::unique_lock<std::mutex>(account.getMutex());
+}
+
+// Recherche sans verrou: l'appelant tient déjà structureMutex
+BankAccount* Bank::lookupAccount(AccountHandle handle) const {
+    if (handle < accounts.size()) {
+        return accounts[handle];
+    }
+    return nullptr;
+}
+
+BankAccount* Bank::lookupAccount(const std::string& accountNumber) const {
+    return lookupAccount(registry.find(accountNumber));
+}
+
+Client* Bank::lookupClient(int clientId) const {
+    auto it = clientMap.find(clientId);
+    if (it != clientMap.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+const std::pmr::vector<BankAccount*>& Bank::clientAccountList(int clientId) const {
+    static const std::pmr::vector<BankAccount*> noAccounts;
+    auto it = clientAccountIndex.find(clientId);
+    if (it != clientAccountIndex.end()) {
+        return it->second;
+    }
+    return noAccounts;
+}
+
+// Pointeur partagé sans allocation: il garde les pools en vie, pas un objet seul
+std::shared_ptr<Client> Bank::share(Client* client) const {
+    if (!client) {
+        return nullptr;
+    }
+    return std::shared_ptr<Client>(pools, client);
+}
+
+std::shared_ptr<BankAccount> Bank::share(BankAccount* account) const {
+    if (!account) {
+        return nullptr;
+    }
+    return std::shared_ptr<BankAccount>(pools, account);
+}
+
+// Les comptes sont déjà résolus (et verrouillés en mode multi-thread).
+// fromAcc est nul pour un dépôt, toAcc est nul pour un retrait.
+// now (VelocityGuard::currentTime) ne sert qu'aux limites de vélocité.
+OperationStatus Bank::checkTransaction(const BankAccount* fromAcc,
+    const BankAccount* toAcc,
+    Money amount,
+    int64_t now) const {
+    // Validation de base
+    if (amount <= Money()) {
+        return OperationStatus::INVALID_AMOUNT;
+    }
+
+    // V�rifier le statut des comptes
+    if ((fromAcc && !fromAcc->isActive()) || (toAcc && !toAcc->isActive())) {
+        return OperationStatus::INACTIVE;
     }
 
     // V�rifier les fonds suffisants pour les retraits/transfers
-    if (!fromAcc->canWithdraw(amount)) {
-        std::cout << "Fonds insuffisants sur le compte source!" << std::endl;
-        return false;
+    if (fromAcc && !fromAcc->canWithdraw(amount)) {
+        return OperationStatus::INSUFFICIENT_FUNDS;
     }
 
-    return true;
+    // Vélocité du compte débité
+    if (fromAcc && velocity.isEnabled()) {
+        return velocity.check(fromAcc->getHandle(), toAcc ? toAcc->getHandle() : NO_ACCOUNT,
+            amount, now);
+    }
+
+    return OperationStatus::OK;
+}
+
+// Message lisible d'une opération, formaté seulement si un EventSink est actif
+void Bank::reportOperation(OperationStatus result,
+    TransactionType type,
+    AccountHandle fromAccount,
+    AccountHandle toAccount,
+    Money amount) const {
+    EventSink* sink = EventSink::active();
+    if (!sink) {
+        return;
+    }
+
+    std::stringstream ss;
+    switch (result) {
+    case OperationStatus::OK:
+        if (type == TransactionType::DEPOSIT) {
+            ss << "Dépôt de " << amount << " sur le compte " << registry.numberOf(toAccount);
+        }
+        else if (type == TransactionType::WITHDRAWAL) {
+            ss << "Retrait de " << amount << " du compte " << registry.numberOf(fromAccount);
+        }
+        else {
+            ss << "Transfert de " << amount << " du compte " << registry.numberOf(fromAccount)
+                << " vers le compte " << registry.numberOf(toAccount);
+        }
+        break;
+    case OperationStatus::NOT_FOUND:
+        if (type != TransactionType::DEPOSIT && registry.numberOf(fromAccount).empty()) {
+            ss << "Compte source non trouv�!";
+        }
+        else {
+            ss << "Compte destinataire non trouv�!";
+        }
+        break;
+    case OperationStatus::INVALID_AMOUNT:
+        ss << "Le montant doit �tre positif!";
+        break;
+    case OperationStatus::INACTIVE:
+        if (type == TransactionType::DEPOSIT) {
+            ss << "Le compte destinataire n'est pas actif!";
+        }
+        else if (type == TransactionType::WITHDRAWAL) {
+            ss << "Le compte source n'est pas actif!";
+        }
+        else {
+            ss << "Le compte source ou destinataire n'est pas actif!";
+        }
+        break;
+    case OperationStatus::INSUFFICIENT_FUNDS:
+        ss << "Fonds insuffisants sur le compte source!";
+        break;
+    case OperationStatus::INVALID_OPERATION:
+        ss << "Transfert impossible vers le même compte!";
+        break;
+    default:
+        ss << operationStatusString(result);
+        break;
+    }
+    sink->emit(ss.str());
+}
+
+void Bank::recordTransaction(AccountHandle fromAccount,
+    AccountHandle toAccount,
+    Money amount,
+    TransactionType type,
+    JournalRecord record) {
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    appendTransaction(fromAccount, toAccount, amount, type,
+        Date::getCurrentDate().toDayNumber(), record);
+
+    // Même ordre dans le journal que dans transactions
+    if (journal) {
+        journal->append(record);
+    }
+}
+
+// Appelé avec transactionsMutex tenu. Complète record si un journal est ouvert.
+size_t Bank::appendTransaction(AccountHandle fromAccount,
+    AccountHandle toAccount,
+    Money amount,
+    TransactionType type,
+    int32_t date,
+    JournalRecord& record) {
+    size_t row = transactions.append(fromAccount, toAccount, amount, type, date);
+    indexTransaction(row);
+
+    if (journal) {
+        if (record.type == (uint8_t)JournalRecordType::NONE) {
+            record.type = (uint8_t)journalTypeOf(type);
+        }
+        record.transactionId = transactions.getId(row);
+        record.date = journalDateOf(date);
+        record.amountCents = amount.getCents();
+        JournalRecord::writeField(record.fromAccount, sizeof(record.fromAccount),
+            registry.numberOf(fromAccount));
+        JournalRecord::writeField(record.toAccount, sizeof(record.toAccount),
+            registry.numberOf(toAccount));
+    }
+    return row;
+}
+
+// Appelé avec transactionsMutex tenu (ou pendant la reprise)
+void Bank::indexTransaction(size_t position) {
+    AccountHandle fromAccount = transactions.getFromAccount(position);
+    AccountHandle toAccount = transactions.getToAccount(position);
+
+    if (fromAccount < accountTransactions.size()) {
+        accountTransactions[fromAccount].push_back(position);
+        rankActivity(fromAccount);
+    }
+    if (toAccount < accountTransactions.size() && toAccount != fromAccount) {
+        accountTransactions[toAccount].push_back(position);
+        rankActivity(toAccount);
+    }
 }
 
-void Bank::recordTransaction(const std::string& fromAccount,
-    const std::string& toAccount,
-    double amount,
-    TransactionType type) {
-    auto transaction = std::make_shared<Transaction>(fromAccount, toAccount, amount, type);
-    transactions.push_back(transaction);
+// Les compteurs ne font que croître d'une unité: un compte hors classement
+// n'y entre qu'en dépassant le dernier, qu'il remplace
+void Bank::rankActivity(AccountHandle handle) {
+    int64_t count = (int64_t)accountTransactions[handle].size();
+    if (activityRanking.contains(handle) || activityRanking.size() < ACTIVITY_RANKING_SIZE) {
+        activityRanking.set(handle, count);
+    }
+    else if (count > activityRanking.front().key) {
+        activityRanking.remove(activityRanking.front().id);
+        activityRanking.set(handle, count);
+    }
 }
 
 // Gestion des clients
 int Bank::addClient(const std::string& firstName, const std::string& lastName,
     const Address& address, ClientType type) {
-    std::shared_ptr<Client> client;
+    Client* client;
 
-    if (type == ClientType::REGULAR) {
-        client = std::make_shared<Client>(firstName, lastName, address);
-    }
-    else {
-        client = std::make_shared<PremiumClient>(firstName, lastName, address);
-    }
+    {
+        auto structure = writeLock();
 
-    clients.push_back(client);
-    clientMap[client->getId()] = client;
+        if (type == ClientType::REGULAR) {
+            client = pools->clients.create(firstName, lastName, address);
+        }
+        else {
+            client = pools->premiumClients.create(firstName, lastName, address);
+        }
 
-    // Enregistrer la transaction d'ouverture
-    recordTransaction("", "", 0, TransactionType::OPEN_ACCOUNT);
+        clients.push_back(client);
+        clientMap[client->getId()] = client;
+        indexClient(*client);
+
+        // Enregistrer la transaction d'ouverture
+        JournalRecord record;
+        record.type = (uint8_t)JournalRecordType::ADD_CLIENT;
+        record.clientType = (uint8_t)type;
+        record.clientId = client->getId();
+        JournalRecord::writeField(record.firstName, sizeof(record.firstName), firstName);
+        JournalRecord::writeField(record.lastName, sizeof(record.lastName), lastName);
+        recordTransaction(NO_ACCOUNT, NO_ACCOUNT, Money(), TransactionType::OPEN_ACCOUNT, record);
+    }
 
     std::cout << "Client " << client->getFullName()
         << " ajout� avec succ�s! ID: " << client->getId() << std::endl;
@@ -86,6 +477,9 @@ int Bank::addClient(const std::string& firstName, const std::string& lastName,
 }
 
 bool Bank::removeClient(int clientId) {
+    // Verrou exclusif: aucune opération n'est en cours sur les comptes
+    auto structure = writeLock();
+
     // V�rifier si le client existe
     auto clientIt = clientMap.find(clientId);
     if (clientIt == clientMap.end()) {
@@ -94,9 +488,9 @@ bool Bank::removeClient(int clientId) {
     }
 
     // V�rifier les comptes du client
-    auto clientAccounts = getClientAccounts(clientId);
+    const auto& clientAccounts = clientAccountList(clientId);
     for (const auto& account : clientAccounts) {
-        if (account->isActive() && account->getBalance() > 0) {
+        if (account->isActive() && account->getBalance() > Money()) {
             std::cout << "Impossible de supprimer le client: compte actif avec solde positif!" << std::endl;
             return false;
         }
@@ -108,14 +502,24 @@ bool Bank::removeClient(int clientId) {
     }
 
     // Supprimer le client
+    // L'objet reste dans son pool: les pointeurs déjà donnés restent valides
     auto it = std::remove_if(clients.begin(), clients.end(),
-        [clientId](const std::shared_ptr<Client>& client) {
+        [clientId](const Client* client) {
             return client->getId() == clientId;
         });
 
     if (it != clients.end()) {
+        unindexClient(*clientIt->second);
         clients.erase(it, clients.end());
         clientMap.erase(clientId);
+        clientAccountIndex.erase(clientId);
+
+        if (journal) {
+            JournalRecord record;
+            record.type = (uint8_t)JournalRecordType::REMOVE_CLIENT;
+            record.clientId = clientId;
+            journal->append(record);
+        }
 
         std::cout << "Client supprim� avec succ�s!" << std::endl;
         return true;
@@ -125,53 +529,105 @@ bool Bank::removeClient(int clientId) {
 }
 
 std::shared_ptr<Client> Bank::findClient(int clientId) const {
-    auto it = clientMap.find(clientId);
-    if (it != clientMap.end()) {
-        return it->second;
-    }
-    return nullptr;
+    auto structure = readLock();
+    return share(lookupClient(clientId));
 }
 
 std::shared_ptr<Client> Bank::findClient(const std::string& firstName,
     const std::string& lastName) const {
-    for (const auto& client : clients) {
-        if (client->getFirstName() == firstName && client->getLastName() == lastName) {
-            return client;
-        }
+    auto structure = readLock();
+    const std::vector<int>* ids = clientNames.findByFullName(firstName, lastName);
+    if (ids && !ids->empty()) {
+        return share(clientMap.at(ids->front()));
     }
     return nullptr;
 }
 
+std::vector<std::shared_ptr<Client>> Bank::findClientsByLastNamePrefix(const std::string& prefix,
+    size_t limit) const {
+    auto structure = readLock();
+    std::vector<std::shared_ptr<Client>> result;
+    for (int clientId : clientNames.findByLastNamePrefix(prefix, limit)) {
+        result.push_back(share(clientMap.at(clientId)));
+    }
+    return result;
+}
+
 std::vector<std::shared_ptr<Client>> Bank::getAllClients() const {
-    return clients;
+    auto structure = readLock();
+    std::vector<std::shared_ptr<Client>> result;
+    result.reserve(clients.size());
+    for (Client* client : clients) {
+        result.push_back(share(client));
+    }
+    return result;
 }
 
 std::vector<std::shared_ptr<Client>> Bank::getClientsByType(ClientType type) const {
+    auto structure = readLock();
     std::vector<std::shared_ptr<Client>> result;
-    for (const auto& client : clients) {
-        if (client->getType() == type) {
-            result.push_back(client);
-        }
+    for (Client* client : clients | std::views::filter(filters::clientType(type))) {
+        result.push_back(share(client));
     }
     return result;
 }
 
+bool Bank::renameClient(int clientId, const std::string& firstName,
+    const std::string& lastName) {
+    auto structure = writeLock();
+
+    Client* client = lookupClient(clientId);
+    if (!client) {
+        return false;
+    }
+
+    // Sans observateur: onClientRenamed reprendrait le verrou déjà tenu
+    std::string oldFirstName = client->getFirstName();
+    std::string oldLastName = client->getLastName();
+    client->setObserver(nullptr);
+    client->setFirstName(firstName);
+    client->setLastName(lastName);
+    client->setObserver(this);
+
+    clientNames.remove(clientId, oldFirstName, oldLastName);
+    clientNames.add(clientId, firstName, lastName);
+    return true;
+}
+
+Client* Bank::getClient(int clientId) const {
+    auto structure = readLock();
+    return lookupClient(clientId);
+}
+
+std::span<Client* const> Bank::getClientsView() const {
+    auto structure = readLock();
+    return clients;
+}
+
 // Gestion des comptes
-std::string Bank::openAccount(int clientId, AccountType type, double initialBalance) {
+std::string Bank::openAccount(int clientId, AccountType type, Money initialBalance) {
+    auto structure = writeLock();
+
     // V�rifier si le client existe
-    auto client = findClient(clientId);
-    if (!client) {
+    if (!lookupClient(clientId)) {
         std::cout << "Client non trouv�!" << std::endl;
         return "";
     }
 
     // Cr�er le compte
-    auto account = std::make_shared<BankAccount>(clientId, type, initialBalance);
+    BankAccount* account = pools->accounts.create(clientId, type, initialBalance);
+    account->setHandle(registry.intern(account->getAccountNumber()));
     accounts.push_back(account);
-    accountMap[account->getAccountNumber()] = account;
+    accountTransactions.emplace_back(&positionPool);
+    clientAccountIndex[clientId].push_back(account);
+    attachAccount(*account);
 
     // Enregistrer la transaction
-    recordTransaction("", account->getAccountNumber(), initialBalance, TransactionType::OPEN_ACCOUNT);
+    JournalRecord record;
+    record.accountType = (uint8_t)type;
+    record.clientId = clientId;
+    recordTransaction(NO_ACCOUNT, account->getHandle(), initialBalance,
+        TransactionType::OPEN_ACCOUNT, record);
 
     std::cout << "Compte ouvert avec succ�s! Num�ro: " << account->getAccountNumber()
         << " Solde initial: " << initialBalance << std::endl;
@@ -180,14 +636,16 @@ std::string Bank::openAccount(int clientId, AccountType type, double initialBala
 }
 
 bool Bank::closeAccount(const std::string& accountNumber) {
-    auto account = findAccount(accountNumber);
+    auto structure = writeLock();
+
+    BankAccount* account = lookupAccount(accountNumber);
     if (!account) {
         std::cout << "Compte non trouv�!" << std::endl;
         return false;
     }
 
     // V�rifier le solde
-    if (account->getBalance() != 0) {
+    if (account->getBalance() != Money()) {
         std::cout << "Impossible de fermer le compte: solde non nul!" << std::endl;
         return false;
     }
@@ -195,7 +653,7 @@ bool Bank::closeAccount(const std::string& accountNumber) {
     // Fermer le compte
     if (account->close()) {
         // Enregistrer la transaction
-        recordTransaction(accountNumber, "", 0, TransactionType::CLOSE_ACCOUNT);
+        recordTransaction(account->getHandle(), NO_ACCOUNT, Money(), TransactionType::CLOSE_ACCOUNT);
 
         std::cout << "Compte ferm� avec succ�s!" << std::endl;
         return true;
@@ -204,91 +662,414 @@ bool Bank::closeAccount(const std::string& accountNumber) {
     return false;
 }
 
-std::shared_ptr<BankAccount> Bank::findAccount(const std::string& accountNumber) const {
-    auto it = accountMap.find(accountNumber);
-    if (it != accountMap.end()) {
-        return it->second;
+// Verrou exclusif, comme closeAccount: aucun dépôt de compte chaud en cours
+OperationStatus Bank::tryFreezeAccount(AccountHandle accountHandle) {
+    auto structure = writeLock();
+
+    BankAccount* account = lookupAccount(accountHandle);
+    if (!account) {
+        return OperationStatus::NOT_FOUND;
     }
-    return nullptr;
+
+    OperationStatus result = account->tryFreeze();
+    if (result == OperationStatus::OK) {
+        journalStatusChange(*account, JournalRecordType::FREEZE);
+    }
+    return result;
+}
+
+OperationStatus Bank::tryActivateAccount(AccountHandle accountHandle) {
+    auto structure = writeLock();
+
+    BankAccount* account = lookupAccount(accountHandle);
+    if (!account) {
+        return OperationStatus::NOT_FOUND;
+    }
+
+    OperationStatus result = account->tryActivate();
+    if (result == OperationStatus::OK) {
+        journalStatusChange(*account, JournalRecordType::ACTIVATE);
+    }
+    return result;
+}
+
+std::shared_ptr<BankAccount> Bank::findAccount(const std::string& accountNumber) const {
+    return findAccount(registry.find(accountNumber));
+}
+
+std::shared_ptr<BankAccount> Bank::findAccount(AccountHandle handle) const {
+    auto structure = readLock();
+    return share(lookupAccount(handle));
+}
+
+BankAccount* Bank::getAccount(AccountHandle handle) const {
+    auto structure = readLock();
+    return lookupAccount(handle);
+}
+
+BankAccount* Bank::getAccount(const std::string& accountNumber) const {
+    return getAccount(registry.find(accountNumber));
+}
+
+AccountHandle Bank::getAccountHandle(const std::string& accountNumber) const {
+    return registry.find(accountNumber);
+}
+
+const std::string& Bank::getAccountNumber(AccountHandle handle) const {
+    return registry.numberOf(handle);
 }
 
 std::vector<std::shared_ptr<BankAccount>> Bank::getClientAccounts(int clientId) const {
+    auto structure = readLock();
+    const auto& clientAccounts = clientAccountList(clientId);
     std::vector<std::shared_ptr<BankAccount>> result;
-    for (const auto& account : accounts) {
-        if (account->getClientId() == clientId) {
-            result.push_back(account);
-        }
+    result.reserve(clientAccounts.size());
+    for (BankAccount* account : clientAccounts) {
+        result.push_back(share(account));
     }
     return result;
 }
 
-std::vector<std::shared_ptr<BankAccount>> Bank::getAllAccounts() const {
+std::span<BankAccount* const> Bank::getClientAccountsView(int clientId) const {
+    auto structure = readLock();
+    return clientAccountList(clientId);
+}
+
+std::span<BankAccount* const> Bank::getAccountsView() const {
+    auto structure = readLock();
     return accounts;
 }
 
+std::vector<std::shared_ptr<BankAccount>> Bank::getAllAccounts() const {
+    auto structure = readLock();
+    std::vector<std::shared_ptr<BankAccount>> result;
+    result.reserve(accounts.size());
+    for (BankAccount* account : accounts) {
+        result.push_back(share(account));
+    }
+    return result;
+}
+
 std::vector<std::shared_ptr<BankAccount>> Bank::getAccountsByType(AccountType type) const {
+    auto structure = readLock();
     std::vector<std::shared_ptr<BankAccount>> result;
-    for (const auto& account : accounts) {
-        if (account->getType() == type) {
-            result.push_back(account);
-        }
+    for (BankAccount* account : accounts | std::views::filter(filters::accountType(type))) {
+        result.push_back(share(account));
     }
     return result;
 }
 
 // Op�rations bancaires
-bool Bank::deposit(const std::string& accountNumber, double amount) {
-    if (!validateTransaction("", accountNumber, amount)) {
-        return false;
-    }
+bool Bank::deposit(const std::string& accountNumber, Money amount) {
+    return deposit(registry.find(accountNumber), amount);
+}
 
-    auto account = findAccount(accountNumber);
-    if (!account) return false;
+bool Bank::withdraw(const std::string& accountNumber, Money amount) {
+    return withdraw(registry.find(accountNumber), amount);
+}
 
-    if (account->deposit(amount)) {
-        recordTransaction("", accountNumber, amount, TransactionType::DEPOSIT);
-        return true;
-    }
+bool Bank::transfer(const std::string& fromAccount, const std::string& toAccount, Money amount) {
+    return transfer(registry.find(fromAccount), registry.find(toAccount), amount);
+}
 
-    return false;
+bool Bank::deposit(AccountHandle accountHandle, Money amount) {
+    OperationStatus result = tryDeposit(accountHandle, amount);
+    reportOperation(result, TransactionType::DEPOSIT, NO_ACCOUNT, accountHandle, amount);
+    return result == OperationStatus::OK;
 }
 
-bool Bank::withdraw(const std::string& accountNumber, double amount) {
-    if (!validateTransaction(accountNumber, "", amount)) {
-        return false;
+bool Bank::withdraw(AccountHandle accountHandle, Money amount) {
+    OperationStatus result = tryWithdraw(accountHandle, amount);
+    reportOperation(result, TransactionType::WITHDRAWAL, accountHandle, NO_ACCOUNT, amount);
+    return result == OperationStatus::OK;
+}
+
+bool Bank::transfer(AccountHandle fromAccount, AccountHandle toAccount, Money amount) {
+    OperationStatus result = tryTransfer(fromAccount, toAccount, amount);
+    reportOperation(result, TransactionType::TRANSFER, fromAccount, toAccount, amount);
+    return result == OperationStatus::OK;
+}
+
+// Variantes silencieuses
+OperationStatus Bank::tryDeposit(AccountHandle accountHandle, Money amount) {
+    auto structure = readLock();
+
+    BankAccount* account = lookupAccount(accountHandle);
+    if (!account) {
+        return OperationStatus::NOT_FOUND;
+    }
+
+    OperationStatus result;
+    if (account->isHot()) {
+        // Compte chaud: le compte vérifie lui-même montant et statut, sans verrou
+        result = account->tryDeposit(amount);
+    }
+    else {
+        auto guard = lockAccount(*account);
+        result = checkTransaction(nullptr, account, amount);
+        if (result == OperationStatus::OK) {
+            result = account->tryDeposit(amount);
+        }
+    }
+    if (result == OperationStatus::OK) {
+        recordTransaction(NO_ACCOUNT, accountHandle, amount, TransactionType::DEPOSIT);
     }
+    return result;
+}
 
-    auto account = findAccount(accountNumber);
-    if (!account) return false;
+OperationStatus Bank::tryWithdraw(AccountHandle accountHandle, Money amount) {
+    auto structure = readLock();
 
-    if (account->withdraw(amount)) {
-        recordTransaction(accountNumber, "", amount, TransactionType::WITHDRAWAL);
-        return true;
+    BankAccount* account = lookupAccount(accountHandle);
+    if (!account) {
+        return OperationStatus::NOT_FOUND;
     }
 
-    return false;
+    // Horloge lue une fois, pour la vérification et l'enregistrement
+    int64_t now = velocity.isEnabled() ? VelocityGuard::currentTime() : 0;
+    auto guard = lockAccount(*account);
+    OperationStatus result = checkTransaction(account, nullptr, amount, now);
+    if (result == OperationStatus::OK) {
+        result = account->tryWithdraw(amount);
+    }
+    if (result == OperationStatus::OK) {
+        if (velocity.isEnabled()) {
+            velocity.record(accountHandle, NO_ACCOUNT, amount, now);
+        }
+        recordTransaction(accountHandle, NO_ACCOUNT, amount, TransactionType::WITHDRAWAL);
+    }
+    return result;
 }
 
-bool Bank::transfer(const std::string& fromAccount, const std::string& toAccount, double amount) {
-    if (!validateTransaction(fromAccount, toAccount, amount)) {
-        return false;
+OperationStatus Bank::tryTransfer(AccountHandle fromAccount, AccountHandle toAccount, Money amount) {
+    auto structure = readLock();
+
+    BankAccount* fromAcc = lookupAccount(fromAccount);
+    if (!fromAcc) {
+        return OperationStatus::NOT_FOUND;
     }
 
-    auto fromAcc = findAccount(fromAccount);
-    auto toAcc = findAccount(toAccount);
+    BankAccount* toAcc = lookupAccount(toAccount);
+    if (!toAcc) {
+        return OperationStatus::NOT_FOUND;
+    }
 
-    if (!fromAcc || !toAcc) return false;
+    // Verrous pris dans l'ordre croissant des handles:
+    // deux transferts croisés A->B et B->A ne peuvent pas s'interbloquer
+    std::unique_lock<std::mutex> firstGuard;
+    std::unique_lock<std::mutex> secondGuard;
+    if (fromAcc == toAcc) {
+        firstGuard = lockAccount(*fromAcc);
+    }
+    else if (fromAccount < toAccount) {
+        firstGuard = lockAccount(*fromAcc);
+        secondGuard = lockAccount(*toAcc);
+    }
+    else {
+        firstGuard = lockAccount(*toAcc);
+        secondGuard = lockAccount(*fromAcc);
+    }
 
-    if (fromAcc->transfer(*toAcc, amount)) {
+    int64_t now = velocity.isEnabled() ? VelocityGuard::currentTime() : 0;
+    OperationStatus result = checkTransaction(fromAcc, toAcc, amount, now);
+    if (result == OperationStatus::OK) {
+        result = fromAcc->tryTransfer(*toAcc, amount);
+    }
+    if (result == OperationStatus::OK) {
+        if (velocity.isEnabled()) {
+            velocity.record(fromAccount, toAccount, amount, now);
+        }
         recordTransaction(fromAccount, toAccount, amount, TransactionType::TRANSFER);
-        return true;
     }
-
-    return false;
+    return result;
 }
 
-// Affichage des informations
+// Lots de règlement
+bool Bank::applyBatch(const std::vector<BatchOperation>& operations,
+    std::vector<OperationStatus>& statuses) {
+    // Verrou exclusif: le lot s'applique d'un bloc sans verrouiller chaque compte
+    auto structure = writeLock();
+
+    statuses.assign(operations.size(), OperationStatus::OK);
+    std::vector<AccountHandle> fromHandles(operations.size(), NO_ACCOUNT);
+    std::vector<AccountHandle> toHandles(operations.size(), NO_ACCOUNT);
+    std::unordered_map<AccountHandle, Money> balances; // soldes simulés
+    bool valid = true;
+
+    for (size_t i = 0; i < operations.size(); i++) {
+        statuses[i] = stageBatchOperation(operations[i], fromHandles[i], toHandles[i], balances);
+        if (statuses[i] != OperationStatus::OK) {
+            valid = false;
+        }
+    }
+
+    if (!valid) {
+        for (OperationStatus& status : statuses) {
+            if (status == OperationStatus::OK) {
+                status = OperationStatus::REJECTED;
+            }
+        }
+        return false;
+    }
+
+    // Un seul changement de solde par compte touché
+    for (const auto& entry : balances) {
+        BankAccount* account = lookupAccount(entry.first);
+        account->restore(entry.second, account->getStatus());
+    }
+
+    // Transactions et journal ajoutés en bloc
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    int32_t date = Date::getCurrentDate().toDayNumber();
+    std::vector<JournalRecord> records;
+    if (journal) {
+        records.reserve(operations.size());
+    }
+    for (size_t i = 0; i < operations.size(); i++) {
+        JournalRecord record;
+        appendTransaction(fromHandles[i], toHandles[i], operations[i].amount,
+            operations[i].type, date, record);
+        if (journal) {
+            records.push_back(record);
+        }
+    }
+    if (journal) {
+        journal->append(records);
+    }
+    return true;
+}
+
+// Résout et valide une opération contre les soldes simulés, puis les met à jour
+OperationStatus Bank::stageBatchOperation(const BatchOperation& operation,
+    AccountHandle& fromAccount,
+    AccountHandle& toAccount,
+    std::unordered_map<AccountHandle, Money>& balances) const {
+    bool debit = operation.type == TransactionType::WITHDRAWAL
+        || operation.type == TransactionType::TRANSFER;
+    bool credit = operation.type == TransactionType::DEPOSIT
+        || operation.type == TransactionType::TRANSFER;
+    if (!debit && !credit) {
+        return OperationStatus::INVALID_OPERATION;
+    }
+
+    BankAccount* fromAcc = nullptr;
+    BankAccount* toAcc = nullptr;
+    if (debit) {
+        fromAccount = registry.find(operation.fromAccount);
+        fromAcc = lookupAccount(fromAccount);
+        if (!fromAcc) {
+            return OperationStatus::NOT_FOUND;
+        }
+    }
+    if (credit) {
+        toAccount = registry.find(operation.toAccount);
+        toAcc = lookupAccount(toAccount);
+        if (!toAcc) {
+            return OperationStatus::NOT_FOUND;
+        }
+    }
+
+    if (fromAcc && fromAcc == toAcc) {
+        return OperationStatus::INVALID_OPERATION;
+    }
+    if (operation.amount <= Money()) {
+        return OperationStatus::INVALID_AMOUNT;
+    }
+    if ((fromAcc && !fromAcc->isActive()) || (toAcc && !toAcc->isActive())) {
+        return OperationStatus::INACTIVE;
+    }
+
+    if (fromAcc) {
+        Money& balance = balances.try_emplace(fromAccount, fromAcc->getBalance()).first->second;
+        if (balance < operation.amount) {
+            return OperationStatus::INSUFFICIENT_FUNDS;
+        }
+        balance -= operation.amount;
+    }
+    if (toAcc) {
+        balances.try_emplace(toAccount, toAcc->getBalance()).first->second += operation.amount;
+    }
+    return OperationStatus::OK;
+}
+
+// Intérêts: rassembler les soldes, calculer sur la colonne, répartir
+InterestSummary Bank::applyInterest(const InterestSchedule& schedule) {
+    // Verrou exclusif, comme un lot: aucun compte n'est verrouillé un à un
+    auto structure = writeLock();
+    foldHotAccountsLocked();
+
+    std::vector<AccountHandle> handles;
+    std::vector<int64_t> balances;
+    handles.reserve(accounts.size());
+    balances.reserve(accounts.size());
+    for (const auto& account : accounts) {
+        if (account->getType() == AccountType::SAVINGS && account->isActive()) {
+            handles.push_back(account->getHandle());
+            balances.push_back(account->getBalance().getCents());
+        }
+    }
+
+    std::vector<int64_t> interest(handles.size());
+    std::vector<int64_t> fees(handles.size());
+    InterestEngine(schedule).computeParallel(balances.data(), interest.data(), fees.data(),
+        handles.size());
+
+    InterestSummary summary = { handles.size(), Money(), Money() };
+    for (size_t i = 0; i < handles.size(); i++) {
+        int64_t net = interest[i] - fees[i];
+        if (net != 0) {
+            BankAccount& account = *accounts[handles[i]];
+            account.restore(Money::fromCents(balances[i] + net), account.getStatus());
+        }
+        summary.totalInterest += Money::fromCents(interest[i]);
+        summary.totalFees += Money::fromCents(fees[i]);
+    }
+
+    // Transactions et journal ajoutés en bloc
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    int32_t date = Date::getCurrentDate().toDayNumber();
+    std::vector<JournalRecord> records;
+    for (size_t i = 0; i < handles.size(); i++) {
+        if (interest[i] > 0) {
+            JournalRecord record;
+            appendTransaction(NO_ACCOUNT, handles[i], Money::fromCents(interest[i]),
+                TransactionType::INTEREST, date, record);
+            if (journal) {
+                records.push_back(record);
+            }
+        }
+        if (fees[i] > 0) {
+            JournalRecord record;
+            appendTransaction(handles[i], NO_ACCOUNT, Money::fromCents(fees[i]),
+                TransactionType::FEE, date, record);
+            if (journal) {
+                records.push_back(record);
+            }
+        }
+    }
+    if (journal) {
+        journal->append(records);
+    }
+    return summary;
+}
+
+// Affichage des informations
 void Bank::displayBankInfo() const {
+    size_t transactionCount;
+    {
+        std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+        if (threadSafe) {
+            lock.lock();
+        }
+        transactionCount = transactions.size();
+    }
+
     std::cout << "========================================\n";
     std::cout << "         INFORMATIONS SUR LA BANQUE\n";
     std::cout << "========================================\n";
@@ -300,13 +1081,15 @@ void Bank::displayBankInfo() const {
     std::cout << "Clients premium: " << getPremiumClientsCount() << std::endl;
     std::cout << "Nombre total de comptes: " << getTotalAccounts() << std::endl;
     std::cout << "Comptes actifs: " << getActiveAccountsCount() << std::endl;
-    std::cout << "Solde total de la banque: " << std::fixed << std::setprecision(2)
+    std::cout << "Solde total de la banque: "
         << getTotalBankBalance() << " �" << std::endl;
-    std::cout << "Transactions effectu�es: " << transactions.size() << std::endl;
+    std::cout << "Transactions effectuées: " << transactionCount << std::endl;
     std::cout << "========================================\n";
 }
 
 void Bank::displayAllClients() const {
+    auto structure = readLock();
+
     std::cout << "========================================\n";
     std::cout << "           LISTE DES CLIENTS\n";
     std::cout << "========================================\n";
@@ -324,6 +1107,8 @@ void Bank::displayAllClients() const {
 }
 
 void Bank::displayAllAccounts() const {
+    auto structure = readLock();
+
     std::cout << "========================================\n";
     std::cout << "           LISTE DES COMPTES\n";
     std::cout << "========================================\n";
@@ -333,6 +1118,7 @@ void Bank::displayAllAccounts() const {
     }
     else {
         for (const auto& account : accounts) {
+            auto guard = lockAccount(*account);
             std::cout << account->toString() << std::endl;
         }
     }
@@ -341,12 +1127,17 @@ void Bank::displayAllAccounts() const {
 }
 
 void Bank::displayAccountInfo(const std::string& accountNumber) const {
-    auto account = findAccount(accountNumber);
+    auto structure = readLock();
+
+    BankAccount* account = lookupAccount(accountNumber);
     if (account) {
-        account->displayInfo();
+        {
+            auto guard = lockAccount(*account);
+            account->displayInfo();
+        }
 
         // Afficher aussi les informations du client
-        auto client = findClient(account->getClientId());
+        Client* client = lookupClient(account->getClientId());
         if (client) {
             std::cout << "\nInformations du client:\n";
             std::cout << "Nom: " << client->getFullName() << std::endl;
@@ -359,15 +1150,18 @@ void Bank::displayAccountInfo(const std::string& accountNumber) const {
 }
 
 void Bank::displayClientInfo(int clientId) const {
-    auto client = findClient(clientId);
+    auto structure = readLock();
+
+    Client* client = lookupClient(clientId);
     if (client) {
         client->displayInfo();
 
         // Afficher les comptes du client
-        auto clientAccounts = getClientAccounts(clientId);
+        const auto& clientAccounts = clientAccountList(clientId);
         if (!clientAccounts.empty()) {
             std::cout << "\nCOMPTES DU CLIENT:\n";
             for (const auto& account : clientAccounts) {
+                auto guard = lockAccount(*account);
                 std::cout << "  - " << account->toString() << std::endl;
             }
         }
@@ -381,6 +1175,11 @@ void Bank::displayClientInfo(int clientId) const {
 }
 
 void Bank::displayTransactionHistory() const {
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+
     std::cout << "========================================\n";
     std::cout << "     HISTORIQUE DES TRANSACTIONS\n";
     std::cout << "========================================\n";
@@ -389,8 +1188,8 @@ void Bank::displayTransactionHistory() const {
         std::cout << "Aucune transaction enregistr�e.\n";
     }
     else {
-        for (const auto& transaction : transactions) {
-            std::cout << transaction->toString() << std::endl;
+        for (const Transaction& transaction : transactions) {
+            std::cout << transaction.toString() << std::endl;
         }
     }
 
@@ -398,61 +1197,510 @@ void Bank::displayTransactionHistory() const {
 }
 
 void Bank::displayAccountTransactions(const std::string& accountNumber) const {
+    auto structure = readLock();
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+
     std::cout << "========================================\n";
     std::cout << "  TRANSACTIONS DU COMPTE " << accountNumber << "\n";
     std::cout << "========================================\n";
 
-    bool found = false;
-    for (const auto& transaction : transactions) {
-        if (transaction->getFromAccount() == accountNumber ||
-            transaction->getToAccount() == accountNumber) {
-            std::cout << transaction->toString() << std::endl;
-            found = true;
-        }
+    TransactionRange history = accountHistory(registry.find(accountNumber));
+    for (const Transaction& transaction : history) {
+        std::cout << transaction.toString() << std::endl;
     }
 
-    if (!found) {
+    if (history.empty()) {
         std::cout << "Aucune transaction trouv�e pour ce compte.\n";
     }
 
     std::cout << "========================================\n";
 }
 
+TransactionRange Bank::getAccountTransactions(const std::string& accountNumber) const {
+    return getAccountTransactions(registry.find(accountNumber));
+}
+
+TransactionRange Bank::getAccountTransactions(AccountHandle handle) const {
+    auto structure = readLock();
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    return accountHistory(handle);
+}
+
+// Appelé avec structureMutex et transactionsMutex tenus
+TransactionRange Bank::accountHistory(AccountHandle handle) const {
+    if (handle >= accountTransactions.size() || accountTransactions[handle].empty()) {
+        return TransactionRange();
+    }
+    const std::pmr::vector<size_t>& positions = accountTransactions[handle];
+    return TransactionRange(&transactions, positions.data(),
+        positions.data() + positions.size());
+}
+
+// Par période: seules les partitions des jours demandés sont lues
+std::vector<Transaction> Bank::getTransactions(const Date& from, const Date& to) const {
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+
+    std::vector<Transaction> result;
+    for (const auto& range : transactions.rangesBetween(from.toDayNumber(), to.toDayNumber())) {
+        for (size_t row = range.first; row < range.last; row++) {
+            result.push_back(transactions.at(row));
+        }
+    }
+    return result;
+}
+
+std::vector<Transaction> Bank::getAccountTransactions(const std::string& accountNumber,
+    const Date& from, const Date& to) const {
+    return getAccountTransactions(registry.find(accountNumber), from, to);
+}
+
+std::vector<Transaction> Bank::getAccountTransactions(AccountHandle handle,
+    const Date& from, const Date& to) const {
+    // accountTransactions grandit à l'ouverture d'un compte (verrou exclusif)
+    auto structure = readLock();
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+
+    std::vector<Transaction> result;
+    if (handle >= accountTransactions.size()) {
+        return result;
+    }
+
+    // Les positions du compte sont triées: recherche dichotomique par plage
+    const std::pmr::vector<size_t>& positions = accountTransactions[handle];
+    for (const auto& range : transactions.rangesBetween(from.toDayNumber(), to.toDayNumber())) {
+        auto it = std::lower_bound(positions.begin(), positions.end(), range.first);
+        for (; it != positions.end() && *it < range.last; ++it) {
+            result.push_back(transactions.at(*it));
+        }
+    }
+    return result;
+}
+
 // Statistiques
 int Bank::getTotalClients() const {
-    return clients.size();
+    checkStatistics();
+    return statistics.getClientCount();
 }
 
 int Bank::getTotalAccounts() const {
-    return accounts.size();
+    checkStatistics();
+    return statistics.getAccountCount();
 }
 
 int Bank::getActiveAccountsCount() const {
-    int count = 0;
-    for (const auto& account : accounts) {
-        if (account->isActive()) {
-            count++;
+    checkStatistics();
+    return statistics.getAccountCount(AccountStatus::ACTIVE);
+}
+
+int Bank::getPremiumClientsCount() const {
+    checkStatistics();
+    return statistics.getPremiumClientCount();
+}
+
+Money Bank::getTotalBankBalance() const {
+    checkStatistics();
+    foldHotAccounts();
+    return statistics.getTotalBalance();
+}
+
+int Bank::getAccountsCount(AccountType type) const {
+    checkStatistics();
+    return statistics.getAccountCount(type);
+}
+
+int Bank::getAccountsCount(AccountStatus status) const {
+    checkStatistics();
+    return statistics.getAccountCount(status);
+}
+
+Money Bank::getTotalBalance(AccountType type) const {
+    checkStatistics();
+    foldHotAccounts();
+    return statistics.getTotalBalance(type);
+}
+
+Money Bank::getTotalBalance(AccountStatus status) const {
+    checkStatistics();
+    foldHotAccounts();
+    return statistics.getTotalBalance(status);
+}
+
+Money Bank::getTransactionTotal(TransactionType type) const {
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    return transactions.totalByType(type);
+}
+
+// Index bitmap
+int Bank::getAccountsCount(AccountType type, AccountStatus status) const {
+    auto bitmaps = bitmapReadLock();
+    return (int)BitmapIndex::intersectionCount(accountsByType[(int)type],
+        accountsByStatus[(int)status]);
+}
+
+int Bank::getClientsCount(ClientType type) const {
+    auto bitmaps = bitmapReadLock();
+    return (int)clientsByType[(int)type].size();
+}
+
+BitmapIndex Bank::getAccountBitmap(AccountType type) const {
+    auto bitmaps = bitmapReadLock();
+    return accountsByType[(int)type];
+}
+
+BitmapIndex Bank::getAccountBitmap(AccountStatus status) const {
+    auto bitmaps = bitmapReadLock();
+    return accountsByStatus[(int)status];
+}
+
+BitmapIndex Bank::getClientBitmap(ClientType type) const {
+    auto bitmaps = bitmapReadLock();
+    return clientsByType[(int)type];
+}
+
+// Classements
+std::vector<RankedAccount> Bank::getTopBalances(size_t n) const {
+    foldHotAccounts();
+    auto structure = readLock();
+
+    std::vector<IndexedHeap<std::greater<int64_t>>::Entry> entries;
+    {
+        std::unique_lock<std::mutex> lock(rankingMutex, std::defer_lock);
+        if (threadSafe) {
+            lock.lock();
         }
+        refreshBalanceRanking();
+        entries = balanceRanking.best(n);
+    }
+
+    std::vector<RankedAccount> result;
+    result.reserve(entries.size());
+    for (const auto& entry : entries) {
+        result.push_back({ entry.id, registry.numberOf(entry.id), entry.key });
     }
-    return count;
+    return result;
 }
 
-int Bank::getPremiumClientsCount() const {
-    int count = 0;
-    for (const auto& client : clients) {
-        if (client->getType() == ClientType::PREMIUM) {
-            count++;
+std::vector<RankedAccount> Bank::getMostActiveAccounts(size_t n) const {
+    auto structure = readLock();
+
+    std::vector<IndexedHeap<std::less<int64_t>>::Entry> entries;
+    {
+        std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+        if (threadSafe) {
+            lock.lock();
+        }
+        entries = activityRanking.sorted(n, std::greater<int64_t>());
+    }
+
+    std::vector<RankedAccount> result;
+    result.reserve(entries.size());
+    for (const auto& entry : entries) {
+        result.push_back({ entry.id, registry.numberOf(entry.id), entry.key });
+    }
+    return result;
+}
+
+// Appelé avec structureMutex et rankingMutex tenus. Le bit est effacé avant
+// la lecture du solde: un changement concurrent le repose pour la suivante.
+void Bank::refreshBalanceRanking() const {
+    for (size_t w = 0; w < dirtyBalances.size(); w++) {
+        if (dirtyBalances[w].load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        uint64_t bits = dirtyBalances[w].exchange(0, std::memory_order_acquire);
+        while (bits != 0) {
+            AccountHandle handle = (AccountHandle)(w * 64 + std::countr_zero(bits));
+            bits &= bits - 1;
+            const BankAccount& account = *accounts[handle];
+            auto guard = lockAccount(account);
+            balanceRanking.set(handle, account.getBalance().getCents());
         }
     }
-    return count;
 }
 
-double Bank::getTotalBankBalance() const {
-    double total = 0.0;
+// Vérification des agrégats
+bool Bank::verifyStatistics() const {
+    // Verrou exclusif: aucune opération en cours, les agrégats sont stables
+    auto structure = writeLock();
+    foldHotAccountsLocked();
+
+    BankStatistics expected;
+    BitmapIndex expectedClients[BankStatistics::CLIENT_TYPE_COUNT];
+    BitmapIndex expectedTypes[BankStatistics::ACCOUNT_TYPE_COUNT];
+    BitmapIndex expectedStatuses[BankStatistics::ACCOUNT_STATUS_COUNT];
+    for (const auto& client : clients) {
+        expected.clientAdded(client->getType());
+        expectedClients[(int)client->getType()].add((uint32_t)client->getId());
+    }
+    for (const auto& account : accounts) {
+        expected.accountAdded(account->getType(), account->getStatus(), account->getBalance());
+        expectedTypes[(int)account->getType()].add(account->getHandle());
+        expectedStatuses[(int)account->getStatus()].add(account->getHandle());
+    }
+
+    // bitmapMutex est pris en dernier, seul: relâché avant les classements,
+    // qui prennent rankingMutex et les verrous des comptes
+    bool bitmapsMatch = true;
+    {
+        auto bitmaps = bitmapReadLock();
+        for (int i = 0; i < BankStatistics::CLIENT_TYPE_COUNT; i++) {
+            bitmapsMatch = bitmapsMatch && clientsByType[i] == expectedClients[i];
+        }
+        for (int i = 0; i < BankStatistics::ACCOUNT_TYPE_COUNT; i++) {
+            bitmapsMatch = bitmapsMatch && accountsByType[i] == expectedTypes[i];
+        }
+        for (int i = 0; i < BankStatistics::ACCOUNT_STATUS_COUNT; i++) {
+            bitmapsMatch = bitmapsMatch && accountsByStatus[i] == expectedStatuses[i];
+        }
+    }
+    if (!bitmapsMatch) {
+        if (EventSink* sink = EventSink::active()) {
+            sink->emit("Index bitmap incoherents");
+        }
+    }
+
+    // Classements: chaque solde à jour, et aucun compte hors classement plus
+    // actif que le dernier classé
+    std::unique_lock<std::mutex> ranking(rankingMutex, std::defer_lock);
+    if (threadSafe) {
+        ranking.lock();
+    }
+    refreshBalanceRanking();
+    bool rankingsMatch = true;
     for (const auto& account : accounts) {
-        total += account->getBalance();
+        AccountHandle handle = account->getHandle();
+        rankingsMatch = rankingsMatch && balanceRanking.contains(handle)
+            && balanceRanking.keyOf(handle) == account->getBalance().getCents();
+
+        int64_t count = (int64_t)accountTransactions[handle].size();
+        if (activityRanking.contains(handle)) {
+            rankingsMatch = rankingsMatch && activityRanking.keyOf(handle) == count;
+        }
+        else if (count > 0) {
+            rankingsMatch = rankingsMatch && activityRanking.size() == ACTIVITY_RANKING_SIZE
+                && count <= activityRanking.front().key;
+        }
+    }
+    if (!rankingsMatch) {
+        if (EventSink* sink = EventSink::active()) {
+            sink->emit("Classements incoherents");
+        }
+    }
+    return statistics.matches(expected) && bitmapsMatch && rankingsMatch;
+}
+
+void Bank::setStatisticsCheck(bool enabled) {
+    statisticsCheck = enabled;
+}
+
+// Rapprochement
+ReconciliationReport Bank::reconcile(unsigned threads) const {
+    ReconciliationReport report;
+    ReconciliationEngine engine;
+    std::vector<int64_t> recorded;
+    std::vector<int64_t> expected;
+
+    {
+        // Coupe cohérente: aucune opération en cours. Les lignes déjà écrites
+        // et leurs blocs ne bougent plus ensuite; seules les suivantes changent.
+        auto structure = writeLock();
+        std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+        if (threadSafe) {
+            lock.lock();
+        }
+
+        report.accounts = accounts.size();
+        recorded.resize(accounts.size());
+        expected.assign(accounts.size(), 0);
+        for (size_t handle = 0; handle < accounts.size(); handle++) {
+            recorded[handle] = accounts[handle]->getBalance().getCents();
+            if (handle < baseBalances.size()) {
+                expected[handle] = baseBalances[handle];
+            }
+        }
+
+        for (size_t c = 0; c < transactions.chunkCount(); c++) {
+            const TransactionStore::Chunk& chunk = transactions.getChunk(c);
+            engine.addBlock(chunk.fromAccounts, chunk.toAccounts, chunk.amounts,
+                transactions.rowsInChunk(c));
+        }
+        report.transactions = engine.size();
+    }
+
+    engine.replay(expected.data(), expected.size(), threads);
+
+    for (size_t handle = 0; handle < expected.size(); handle++) {
+        if (expected[handle] != recorded[handle]) {
+            ReconciliationMismatch mismatch;
+            mismatch.handle = (AccountHandle)handle;
+            mismatch.accountNumber = registry.numberOf((AccountHandle)handle);
+            mismatch.recorded = Money::fromCents(recorded[handle]);
+            mismatch.expected = Money::fromCents(expected[handle]);
+            report.mismatches.push_back(mismatch);
+        }
+    }
+    return report;
+}
+
+void Bank::checkStatistics() const {
+    if (statisticsCheck) {
+        bool consistent = verifyStatistics();
+        assert(consistent && "statistiques de la banque incoherentes");
+        (void)consistent;
+    }
+}
+
+// Limites de vélocité
+void Bank::setVelocityLimits(const VelocityLimits& limits) {
+    // Verrou exclusif: aucune vérification en cours pendant le changement
+    auto structure = writeLock();
+    velocity.configure(limits);
+}
+
+VelocityLimits Bank::getVelocityLimits() const {
+    auto structure = readLock();
+    return velocity.getLimits();
+}
+
+// Comptes chauds
+bool Bank::setHotAccount(const std::string& accountNumber, bool enabled) {
+    // Verrou exclusif: aucun dépôt en cours pendant le changement de mode
+    auto structure = writeLock();
+
+    BankAccount* account = lookupAccount(accountNumber);
+    if (!account) {
+        return false;
+    }
+
+    auto guard = lockAccount(*account);
+    account->setHot(enabled);
+    AccountHandle handle = account->getHandle();
+    auto it = std::find(hotAccounts.begin(), hotAccounts.end(), handle);
+    if (enabled && it == hotAccounts.end()) {
+        hotAccounts.push_back(handle);
+    }
+    else if (!enabled && it != hotAccounts.end()) {
+        hotAccounts.erase(it);
     }
-    return total;
+    return true;
+}
+
+// Les dépôts des comptes chauds n'atteignent les statistiques qu'une fois versés
+void Bank::foldHotAccounts() const {
+    auto structure = readLock();
+    foldHotAccountsLocked();
+}
+
+// Appelé avec structureMutex tenu
+void Bank::foldHotAccountsLocked() const {
+    for (AccountHandle handle : hotAccounts) {
+        BankAccount& account = *accounts[handle];
+        auto guard = lockAccount(account);
+        account.foldStripes();
+    }
+}
+
+// Suivi des comptes
+void Bank::attachAccount(BankAccount& account) {
+    account.setObserver(this);
+    velocity.addAccount(account.getHandle());
+    statistics.accountAdded(account.getType(), account.getStatus(), account.getBalance());
+
+    {
+        auto bitmaps = bitmapWriteLock();
+        accountsByType[(int)account.getType()].add(account.getHandle());
+        accountsByStatus[(int)account.getStatus()].add(account.getHandle());
+    }
+
+    std::unique_lock<std::mutex> lock(rankingMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    while (dirtyBalances.size() * 64 <= account.getHandle()) {
+        dirtyBalances.emplace_back(0);
+    }
+    balanceRanking.set(account.getHandle(), account.getBalance().getCents());
+}
+
+// Appelé par le compte, sous son verrou. newBalance plutôt que getBalance():
+// un dépôt chaud arrivé depuis le versement serait compté deux fois
+void Bank::onAccountChanged(const BankAccount& account,
+    Money oldBalance, Money newBalance, AccountStatus oldStatus) {
+    statistics.accountChanged(account.getType(), oldBalance, oldStatus,
+        newBalance, account.getStatus());
+
+    // Seul un changement de statut touche aux bitmaps (et à leur verrou)
+    if (account.getStatus() != oldStatus) {
+        auto bitmaps = bitmapWriteLock();
+        accountsByStatus[(int)oldStatus].remove(account.getHandle());
+        accountsByStatus[(int)account.getStatus()].add(account.getHandle());
+    }
+
+    // Classement par solde: marqué seulement, réordonné à la lecture. Le bit
+    // déjà posé n'est pas réécrit (pas d'écriture sur la ligne partagée).
+    if (newBalance != oldBalance) {
+        AccountHandle handle = account.getHandle();
+        std::atomic<uint64_t>& word = dirtyBalances[handle / 64];
+        uint64_t bit = uint64_t(1) << (handle % 64);
+        if ((word.load(std::memory_order_relaxed) & bit) == 0) {
+            word.fetch_or(bit, std::memory_order_relaxed);
+        }
+    }
+
+    // Premier changement depuis le gel: conserver les valeurs gelées
+    AccountHandle handle = account.getHandle();
+    if (handle < snapshotAccounts.load(std::memory_order_acquire)) {
+        SnapshotSlot& slot = snapshotSlots[handle];
+        if (slot.epoch != snapshotEpoch) {
+            slot.epoch = snapshotEpoch;
+            slot.balance = oldBalance;
+            slot.status = oldStatus;
+        }
+    }
+}
+
+// Suivi des clients
+void Bank::indexClient(Client& client) {
+    client.setObserver(this);
+    statistics.clientAdded(client.getType());
+    clientNames.add(client.getId(), client.getFirstName(), client.getLastName());
+
+    auto bitmaps = bitmapWriteLock();
+    clientsByType[(int)client.getType()].add((uint32_t)client.getId());
+}
+
+void Bank::unindexClient(Client& client) {
+    client.setObserver(nullptr);
+    statistics.clientRemoved(client.getType());
+    clientNames.remove(client.getId(), client.getFirstName(), client.getLastName());
+
+    auto bitmaps = bitmapWriteLock();
+    clientsByType[(int)client.getType()].remove((uint32_t)client.getId());
+}
+
+// Appelé par Client::setFirstName / setLastName, le nom déjà changé.
+// Le nom lui-même a changé sans verrou: en mode multi-thread, seul
+// renameClient est sûr.
+void Bank::onClientRenamed(const Client& client,
+    const std::string& oldFirstName, const std::string& oldLastName) {
+    auto structure = writeLock();
+    clientNames.remove(client.getId(), oldFirstName, oldLastName);
+    clientNames.add(client.getId(), client.getFirstName(), client.getLastName());
 }
 
 // Getters
@@ -464,6 +1712,165 @@ std::string Bank::getBankCode() const {
     return bankCode;
 }
 
+void Bank::setThreadSafe(bool enabled) {
+    // À appeler avant de partager la banque entre plusieurs threads
+    threadSafe = enabled;
+}
+
+bool Bank::isThreadSafe() const {
+    return threadSafe;
+}
+
+// Rapports CSV et JSON
+bool Bank::exportClients(std::ostream& out, ReportFormat format, unsigned threads) const {
+    auto structure = readLock();
+
+    ReportWriter writer(out, format, threads);
+    writer.write(format == ReportFormat::CSV ? CLIENTS_CSV_HEADER : "[");
+    writer.writeRows(clients.size(), [&](size_t first, size_t last, ReportBuffer& buffer) {
+        for (size_t i = first; i < last; i++) {
+            const Client& client = *clients[i];
+            const char* type = client.getType() == ClientType::PREMIUM ? "PREMIUM" : "REGULAR";
+            size_t accountCount = clientAccountList(client.getId()).size();
+            if (format == ReportFormat::CSV) {
+                buffer.appendInt(client.getId());
+                buffer.append(',');
+                buffer.append(type);
+                buffer.append(',');
+                buffer.appendText(client.getFirstName(), format);
+                buffer.append(',');
+                buffer.appendText(client.getLastName(), format);
+                buffer.append(',');
+                buffer.appendInt((int64_t)accountCount);
+                buffer.append('\n');
+            }
+            else {
+                beginJsonRow(buffer, i);
+                buffer.append("{\"id\":");
+                buffer.appendInt(client.getId());
+                buffer.append(",\"type\":\"");
+                buffer.append(type);
+                buffer.append("\",\"firstName\":");
+                buffer.appendText(client.getFirstName(), format);
+                buffer.append(",\"lastName\":");
+                buffer.appendText(client.getLastName(), format);
+                buffer.append(",\"accounts\":");
+                buffer.appendInt((int64_t)accountCount);
+                buffer.append('}');
+            }
+        }
+    });
+    if (format == ReportFormat::JSON) {
+        writer.write("\n]\n");
+    }
+    return writer.good();
+}
+
+bool Bank::exportAccounts(std::ostream& out, ReportFormat format, unsigned threads) const {
+    auto structure = readLock();
+    std::vector<std::string_view> numbers = collectAccountNumbers(registry);
+
+    ReportWriter writer(out, format, threads);
+    writer.write(format == ReportFormat::CSV ? ACCOUNTS_CSV_HEADER : "[");
+    writer.writeRows(accounts.size(), [&](size_t first, size_t last, ReportBuffer& buffer) {
+        for (size_t handle = first; handle < last; handle++) {
+            const BankAccount& account = *accounts[handle];
+            auto guard = lockAccount(account);
+            if (format == ReportFormat::CSV) {
+                appendAccountFields(buffer, account, numbers[handle], format);
+                buffer.append('\n');
+            }
+            else {
+                beginJsonRow(buffer, handle);
+                buffer.append('{');
+                appendAccountFields(buffer, account, numbers[handle], format);
+                buffer.append('}');
+            }
+        }
+    });
+    if (format == ReportFormat::JSON) {
+        writer.write("\n]\n");
+    }
+    return writer.good();
+}
+
+bool Bank::exportTransactions(std::ostream& out, ReportFormat format, unsigned threads) const {
+    auto structure = readLock();
+    std::unique_lock<std::mutex> lock(transactionsMutex, std::defer_lock);
+    if (threadSafe) {
+        lock.lock();
+    }
+    std::vector<std::string_view> numbers = collectAccountNumbers(registry);
+
+    ReportWriter writer(out, format, threads);
+    writer.write(format == ReportFormat::CSV ? TRANSACTIONS_CSV_HEADER : "[");
+    writer.writeRows(transactions.size(), [&](size_t first, size_t last, ReportBuffer& buffer) {
+        for (size_t row = first; row < last; row++) {
+            if (format == ReportFormat::CSV) {
+                appendTransactionFields(buffer, transactions, row, numbers, format);
+                buffer.append('\n');
+            }
+            else {
+                beginJsonRow(buffer, row);
+                buffer.append('{');
+                appendTransactionFields(buffer, transactions, row, numbers, format);
+                buffer.append('}');
+            }
+        }
+    });
+    if (format == ReportFormat::JSON) {
+        writer.write("\n]\n");
+    }
+    return writer.good();
+}
+
+// Verrou exclusif: les soldes correspondent exactement aux historiques, et
+// les threads du rapport lisent les comptes sans prendre leurs verrous
+bool Bank::exportStatements(std::ostream& out, ReportFormat format, unsigned threads) const {
+    auto structure = writeLock();
+    std::vector<std::string_view> numbers = collectAccountNumbers(registry);
+
+    ReportWriter writer(out, format, threads);
+    writer.write(format == ReportFormat::CSV ? STATEMENTS_CSV_HEADER : "[");
+    writer.writeRows(accounts.size(), [&](size_t first, size_t last, ReportBuffer& buffer) {
+        for (size_t handle = first; handle < last; handle++) {
+            if (format == ReportFormat::JSON) {
+                beginJsonRow(buffer, handle);
+            }
+            appendStatement(buffer, *accounts[handle], accountTransactions[handle],
+                transactions, numbers, format);
+        }
+    });
+    if (format == ReportFormat::JSON) {
+        writer.write("\n]\n");
+    }
+    return writer.good();
+}
+
+bool Bank::exportAccountStatement(const std::string& accountNumber, std::ostream& out,
+    ReportFormat format) const {
+    auto structure = writeLock();
+
+    BankAccount* account = lookupAccount(accountNumber);
+    if (!account) {
+        return false;
+    }
+    std::vector<std::string_view> numbers = collectAccountNumbers(registry);
+
+    ReportWriter writer(out, format, 1);
+    if (format == ReportFormat::CSV) {
+        writer.write(STATEMENTS_CSV_HEADER);
+    }
+    writer.writeRows(1, [&](size_t, size_t, ReportBuffer& buffer) {
+        appendStatement(buffer, *account, accountTransactions[account->getHandle()],
+            transactions, numbers, format);
+        if (format == ReportFormat::JSON) {
+            buffer.append('\n');
+        }
+    });
+    return writer.good();
+}
+
 // Sauvegarde et chargement (impl�mentation de base)
 bool Bank::saveToFile(const std::string& filename) const {
     std::ofstream file(filename);
@@ -531,4 +1938,398 @@ bool Bank::loadFromFile(const std::string& filename) {
     file.close();
     std::cout << "Donn�es charg�es depuis " << filename << std::endl;
     return true;
+}
+
+// Journal binaire
+bool Bank::openJournal(const std::string& filename, int commitIntervalMs) {
+    auto journalFile = std::make_unique<Journal>();
+    if (!journalFile->open(filename, commitIntervalMs)) {
+        std::cout << "Erreur: impossible d'ouvrir le journal " << filename << std::endl;
+        return false;
+    }
+
+    auto structure = writeLock();
+    // Le journal ne contient que des opérations: l'état déjà présent n'y
+    // serait pas, et la reprise reconstruirait de faux soldes
+    if (!clients.empty() || !accounts.empty() || !transactions.empty()) {
+        std::cout << "Erreur: le journal s'ouvre sur une banque vide" << std::endl;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(transactionsMutex);
+    journal = std::move(journalFile);
+    return true;
+}
+
+void Bank::closeJournal() {
+    std::unique_ptr<Journal> closing;
+    {
+        auto structure = writeLock();
+        std::lock_guard<std::mutex> lock(transactionsMutex);
+        closing = std::move(journal);
+    }
+    // Le destructeur écrit et synchronise ce qui reste
+}
+
+bool Bank::flushJournal() {
+    // Verrou partagé: le journal ne peut pas être fermé pendant l'attente,
+    // les opérations continuent
+    auto structure = readLock();
+    return journal && journal->flush();
+}
+
+bool Bank::recoverFromJournal(const std::string& filename) {
+    auto structure = writeLock();
+
+    if (!clients.empty() || !accounts.empty() || !transactions.empty()) {
+        std::cout << "Erreur: la reprise du journal exige une banque vide" << std::endl;
+        return false;
+    }
+
+    long long count = Journal::read(filename, [this](const JournalRecord& record) {
+        replayRecord(record);
+    });
+    if (count < 0) {
+        std::cout << "Erreur: journal illisible " << filename << std::endl;
+        return false;
+    }
+
+    std::cout << "Journal rejoué: " << count << " enregistrements, "
+        << clients.size() << " clients, " << accounts.size() << " comptes" << std::endl;
+    return true;
+}
+
+// Appelé avec structureMutex exclusif: l'enregistrement suit les
+// transactions déjà journalisées du compte
+void Bank::journalStatusChange(const BankAccount& account, JournalRecordType type) {
+    if (!journal) {
+        return;
+    }
+
+    JournalRecord record;
+    record.type = (uint8_t)type;
+    record.clientId = account.getClientId();
+    record.date = journalDateOf(Date::getCurrentDate().toDayNumber());
+    JournalRecord::writeField(record.fromAccount, sizeof(record.fromAccount),
+        registry.numberOf(account.getHandle()));
+    journal->append(record);
+}
+
+// Applique un enregistrement sans validation ni message (reprise)
+void Bank::replayRecord(const JournalRecord& record) {
+    std::string fromAccount = JournalRecord::readField(record.fromAccount, sizeof(record.fromAccount));
+    std::string toAccount = JournalRecord::readField(record.toAccount, sizeof(record.toAccount));
+    AccountHandle fromHandle = registry.find(fromAccount);
+    AccountHandle toHandle = registry.find(toAccount);
+    Money amount = Money::fromCents(record.amountCents);
+    TransactionType transactionType = TransactionType::OPEN_ACCOUNT;
+
+    switch ((JournalRecordType)record.type) {
+    case JournalRecordType::ADD_CLIENT: {
+        std::string firstName = JournalRecord::readField(record.firstName, sizeof(record.firstName));
+        std::string lastName = JournalRecord::readField(record.lastName, sizeof(record.lastName));
+        Address addr("", "", "", "");
+        Client* client;
+        if ((ClientType)record.clientType == ClientType::PREMIUM) {
+            client = pools->premiumClients.create(record.clientId, firstName, lastName, addr);
+        }
+        else {
+            client = pools->clients.create(record.clientId, firstName, lastName, addr,
+                ClientType::REGULAR);
+        }
+        clients.push_back(client);
+        clientMap[client->getId()] = client;
+        indexClient(*client);
+        break;
+    }
+    case JournalRecordType::REMOVE_CLIENT: {
+        int clientId = record.clientId;
+        // Comme removeClient: un compte qui garde un solde (gelé, par exemple)
+        // n'est pas fermé et garde son statut
+        for (const auto& account : clientAccountList(clientId)) {
+            account->tryClose();
+        }
+        clientAccountIndex.erase(clientId);
+        auto clientIt = clientMap.find(clientId);
+        if (clientIt != clientMap.end()) {
+            unindexClient(*clientIt->second);
+        }
+        clients.erase(std::remove_if(clients.begin(), clients.end(),
+            [clientId](const Client* client) {
+                return client->getId() == clientId;
+            }), clients.end());
+        clientMap.erase(clientId);
+        return; // pas de transaction associée
+    }
+    case JournalRecordType::FREEZE: {
+        BankAccount* account = lookupAccount(fromHandle);
+        if (account) {
+            account->tryFreeze();
+        }
+        return;
+    }
+    case JournalRecordType::ACTIVATE: {
+        BankAccount* account = lookupAccount(fromHandle);
+        if (account) {
+            account->tryActivate();
+        }
+        return;
+    }
+    case JournalRecordType::OPEN_ACCOUNT: {
+        // La date de l'enregistrement d'ouverture est la date d'ouverture
+        BankAccount* account = pools->accounts.create(toAccount, record.clientId,
+            (AccountType)record.accountType, amount, dateOf(record.date));
+        toHandle = registry.intern(toAccount);
+        account->setHandle(toHandle);
+        accounts.push_back(account);
+        accountTransactions.emplace_back(&positionPool);
+        clientAccountIndex[record.clientId].push_back(account);
+        attachAccount(*account);
+        break;
+    }
+    case JournalRecordType::CLOSE_ACCOUNT: {
+        BankAccount* account = lookupAccount(fromHandle);
+        if (account) {
+            account->restore(account->getBalance(), AccountStatus::CLOSED);
+        }
+        transactionType = TransactionType::CLOSE_ACCOUNT;
+        break;
+    }
+    case JournalRecordType::DEPOSIT: {
+        BankAccount* account = lookupAccount(toHandle);
+        if (account) {
+            account->restore(account->getBalance() + amount, account->getStatus());
+        }
+        transactionType = TransactionType::DEPOSIT;
+        break;
+    }
+    case JournalRecordType::WITHDRAWAL: {
+        BankAccount* account = lookupAccount(fromHandle);
+        if (account) {
+            account->restore(account->getBalance() - amount, account->getStatus());
+        }
+        transactionType = TransactionType::WITHDRAWAL;
+        break;
+    }
+    case JournalRecordType::TRANSFER: {
+        BankAccount* fromAcc = lookupAccount(fromHandle);
+        BankAccount* toAcc = lookupAccount(toHandle);
+        if (fromAcc) {
+            fromAcc->restore(fromAcc->getBalance() - amount, fromAcc->getStatus());
+        }
+        if (toAcc) {
+            toAcc->restore(toAcc->getBalance() + amount, toAcc->getStatus());
+        }
+        transactionType = TransactionType::TRANSFER;
+        break;
+    }
+    case JournalRecordType::INTEREST: {
+        BankAccount* account = lookupAccount(toHandle);
+        if (account) {
+            account->restore(account->getBalance() + amount, account->getStatus());
+        }
+        transactionType = TransactionType::INTEREST;
+        break;
+    }
+    case JournalRecordType::FEE: {
+        BankAccount* account = lookupAccount(fromHandle);
+        if (account) {
+            account->restore(account->getBalance() - amount, account->getStatus());
+        }
+        transactionType = TransactionType::FEE;
+        break;
+    }
+    default:
+        return;
+    }
+
+    Transaction::countRestoredTransaction(record.transactionId);
+    indexTransaction(transactions.appendWithId(record.transactionId,
+        fromHandle, toHandle, amount, transactionType, dayNumberOf(record.date)));
+}
+
+// Instantanés
+bool Bank::startSnapshot(const std::string& filename) {
+    std::lock_guard<std::mutex> control(snapshotMutex);
+    if (snapshotRunning) {
+        return false;
+    }
+    if (snapshotThread.joinable()) {
+        snapshotThread.join(); // instantané précédent déjà terminé
+    }
+
+    SnapshotHeader header;
+    std::vector<SnapshotClientRecord> clientRecords;
+    size_t accountCount;
+    {
+        // Gel: aucune opération en cours, toutes prennent structureMutex
+        auto structure = writeLock();
+
+        snapshotEpoch++;
+        accountCount = accounts.size();
+        if (snapshotSlots.size() < accountCount) {
+            snapshotSlots.resize(accountCount, SnapshotSlot{ 0, Money(), AccountStatus::ACTIVE });
+        }
+
+        // Les dépôts des comptes chauds contournent le verrou du compte:
+        // leur solde est figé dès maintenant
+        for (AccountHandle handle : hotAccounts) {
+            BankAccount& account = *accounts[handle];
+            auto guard = lockAccount(account);
+            account.foldStripes();
+            snapshotSlots[handle] = SnapshotSlot{ snapshotEpoch, account.getBalance(), account.getStatus() };
+        }
+        snapshotAccounts.store(accountCount, std::memory_order_release);
+        snapshotRunning = true;
+
+        header.epoch = snapshotEpoch;
+        header.day = Date::getCurrentDate().toDayNumber();
+        JournalRecord::writeField(header.bankName, sizeof(header.bankName), name);
+        JournalRecord::writeField(header.bankCode, sizeof(header.bankCode), bankCode);
+
+        // Les clients peuvent être renommés ou supprimés: copiés au gel
+        clientRecords.resize(clients.size());
+        for (size_t i = 0; i < clients.size(); i++) {
+            const Client& client = *clients[i];
+            SnapshotClientRecord& record = clientRecords[i];
+            record.clientId = client.getId();
+            record.clientType = (uint8_t)client.getType();
+            record.reserved[0] = record.reserved[1] = record.reserved[2] = 0;
+            JournalRecord::writeField(record.firstName, sizeof(record.firstName), client.getFirstName());
+            JournalRecord::writeField(record.lastName, sizeof(record.lastName), client.getLastName());
+        }
+    }
+
+    if (threadSafe) {
+        snapshotThread = std::thread([this, filename, header,
+            clientRecords = std::move(clientRecords), accountCount]() {
+            snapshotResult = writeSnapshot(filename, header, clientRecords, accountCount);
+        });
+        return true;
+    }
+
+    snapshotResult = writeSnapshot(filename, header, clientRecords, accountCount);
+    return snapshotResult;
+}
+
+bool Bank::waitSnapshot() {
+    std::lock_guard<std::mutex> control(snapshotMutex);
+    if (snapshotThread.joinable()) {
+        snapshotThread.join();
+    }
+    return snapshotResult;
+}
+
+// Écriture de l'instantané gelé: les comptes sont lus par paquets, le verrou
+// de structure n'étant tenu en lecture que le temps d'un paquet
+bool Bank::writeSnapshot(const std::string& filename, const SnapshotHeader& header,
+    const std::vector<SnapshotClientRecord>& clientRecords, size_t accountCount) {
+    const size_t BATCH_SIZE = 1024;
+
+    SnapshotWriter writer;
+    bool ok = writer.open(filename) &&
+        writer.writeClients(clientRecords.data(), clientRecords.size());
+
+    std::vector<SnapshotAccountRecord> batch(BATCH_SIZE);
+    for (size_t first = 0; ok && first < accountCount; first += BATCH_SIZE) {
+        size_t count = std::min(BATCH_SIZE, accountCount - first);
+        {
+            auto structure = readLock();
+            for (size_t i = 0; i < count; i++) {
+                AccountHandle handle = (AccountHandle)(first + i);
+                const BankAccount& account = *accounts[handle];
+                SnapshotAccountRecord& record = batch[i];
+                JournalRecord::writeField(record.accountNumber, sizeof(record.accountNumber),
+                    registry.numberOf(handle));
+                record.clientId = account.getClientId();
+                record.accountType = (uint8_t)account.getType();
+                record.reserved = 0;
+
+                // Non modifié depuis le gel: l'état courant est l'état gelé
+                auto guard = lockAccount(account);
+                const SnapshotSlot& slot = snapshotSlots[handle];
+                if (slot.epoch == header.epoch) {
+                    record.balanceCents = slot.balance.getCents();
+                    record.status = (uint8_t)slot.status;
+                }
+                else {
+                    record.balanceCents = account.getBalance().getCents();
+                    record.status = (uint8_t)account.getStatus();
+                }
+            }
+        }
+        ok = writer.writeAccounts(batch.data(), count);
+    }
+    ok = ok && writer.commit(header);
+
+    {
+        auto structure = writeLock();
+        snapshotAccounts.store(0, std::memory_order_release);
+        snapshotRunning = false;
+    }
+    return ok;
+}
+
+bool Bank::loadSnapshot(const std::string& filename) {
+    SnapshotFile snapshot;
+    if (!snapshot.open(filename)) {
+        std::cout << "Erreur: instantané illisible " << filename << std::endl;
+        return false;
+    }
+
+    auto structure = writeLock();
+
+    if (!clients.empty() || !accounts.empty() || !transactions.empty()) {
+        std::cout << "Erreur: le chargement d'un instantané exige une banque vide" << std::endl;
+        return false;
+    }
+
+    const SnapshotHeader& header = snapshot.getHeader();
+    name = JournalRecord::readField(header.bankName, sizeof(header.bankName));
+    bankCode = JournalRecord::readField(header.bankCode, sizeof(header.bankCode));
+
+    Address addr("", "", "", "");
+    clients.reserve(header.clientCount);
+    for (const SnapshotClientRecord& record : snapshot.getClients()) {
+        std::string firstName = JournalRecord::readField(record.firstName, sizeof(record.firstName));
+        std::string lastName = JournalRecord::readField(record.lastName, sizeof(record.lastName));
+        Client* client;
+        if ((ClientType)record.clientType == ClientType::PREMIUM) {
+            client = pools->premiumClients.create(record.clientId, firstName, lastName, addr);
+        }
+        else {
+            client = pools->clients.create(record.clientId, firstName, lastName, addr,
+                ClientType::REGULAR);
+        }
+        clients.push_back(client);
+        clientMap[client->getId()] = client;
+        indexClient(*client);
+    }
+
+    accounts.reserve(header.accountCount);
+    baseBalances.reserve(header.accountCount);
+    accountTransactions.reserve(header.accountCount);
+    for (const SnapshotAccountRecord& record : snapshot.getAccounts()) {
+        std::string accountNumber = JournalRecord::readField(record.accountNumber,
+            sizeof(record.accountNumber));
+        Money balance = Money::fromCents(record.balanceCents);
+        baseBalances.push_back(record.balanceCents);
+        // L'instantané ne garde pas la date d'ouverture
+        BankAccount* account = pools->accounts.create(accountNumber, record.clientId,
+            (AccountType)record.accountType, balance, Date::getCurrentDate());
+        if ((AccountStatus)record.status != AccountStatus::ACTIVE) {
+            account->restore(balance, (AccountStatus)record.status);
+        }
+        account->setHandle(registry.intern(accountNumber));
+        accounts.push_back(account);
+        accountTransactions.emplace_back(&positionPool);
+        // Les comptes des clients supprimés restent, fermés, hors de l'index
+        if (clientMap.count(record.clientId)) {
+            clientAccountIndex[record.clientId].push_back(account);
+        }
+        attachAccount(*account);
+    }
+
+    std::cout << "Instantané chargé: " << clients.size() << " clients, "
+        << accounts.size() << " comptes" << std::endl;
+    return true;
 }
\ No newline at end of file
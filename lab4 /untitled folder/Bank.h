@@ -5,60 +5,321 @@
 #include "PremiumClient.h"
 #include "BankAccount.h"
 #include "Transaction.h"
+#include "TransactionStore.h"
+#include "BankStatistics.h"
+#include "BatchOperation.h"
+#include "ClientNameIndex.h"
+#include "Journal.h"
+#include "Snapshot.h"
+#include "InterestEngine.h"
+#include "VelocityGuard.h"
+#include "ObjectPool.h"
+#include "ReportWriter.h"
+#include "ReconciliationEngine.h"
+#include "BankFilter.h"
+#include "BitmapIndex.h"
+#include "IndexedHeap.h"
 #include <vector>
+#include <deque>
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <mutex>
+#include <shared_mutex>
+#include <cstddef>
+#include <span>
+#include <atomic>
+#include <thread>
+#include <memory_resource>
+#include <ranges>
 
-class Bank {
+// Vue lgre sur une partie des transactions (positions dans la liste),
+// sans copie. Valide tant que la banque ne reoit pas de nouvelle opration.
+class TransactionRange {
+private:
+    const TransactionStore* all;
+    const size_t* first;
+    const size_t* last;
+
+public:
+    class iterator {
+    private:
+        const TransactionStore* all;
+        const size_t* position;
+
+    public:
+        iterator(const TransactionStore* all, const size_t* position)
+            : all(all), position(position) {}
+
+        Transaction operator*() const { return all->at(*position); }
+        iterator& operator++() { ++position; return *this; }
+        bool operator==(const iterator& other) const { return position == other.position; }
+        bool operator!=(const iterator& other) const { return position != other.position; }
+    };
+
+    TransactionRange() : all(nullptr), first(nullptr), last(nullptr) {}
+    TransactionRange(const TransactionStore* all, const size_t* first, const size_t* last)
+        : all(all), first(first), last(last) {}
+
+    iterator begin() const { return iterator(all, first); }
+    iterator end() const { return iterator(all, last); }
+    size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+};
+
+// Entre d'un classement de comptes (getTopBalances, getMostActiveAccounts)
+struct RankedAccount {
+    AccountHandle handle;
+    std::string accountNumber;
+    int64_t value;   // solde en centimes, ou nombre de transactions
+};
+
+class Bank : private AccountObserver, private ClientObserver {
 private:
     std::string name;
     std::string bankCode;
 
+    // Clients et comptes construits dans des pools possds par la banque.
+    // Un pointeur partag n'est cr que pour un objet qui sort de la banque
+    // (findClient, findAccount...): il partage alors la vie des pools.
+    struct EntityPools {
+        ObjectPool<Client> clients;
+        ObjectPool<PremiumClient> premiumClients;
+        ObjectPool<BankAccount> accounts;
+    };
+    std::shared_ptr<EntityPools> pools;
+
+    // Mmoire des index (entres et listes), recycle d'une opration  l'autre:
+    // indexPool sous structureMutex, positionPool sous transactionsMutex
+    std::pmr::unsynchronized_pool_resource indexPool;
+    std::pmr::unsynchronized_pool_resource positionPool;
+
     // Collections d'objets
-    std::vector<std::shared_ptr<Client>> clients;
-    std::vector<std::shared_ptr<BankAccount>> accounts;
-    std::vector<std::shared_ptr<Transaction>> transactions;
+    std::vector<Client*> clients;
+    std::vector<BankAccount*> accounts;
+    TransactionStore transactions;
 
     // Recherche rapide par ID
-    std::unordered_map<int, std::shared_ptr<Client>> clientMap;
-    std::unordered_map<std::string, std::shared_ptr<BankAccount>> accountMap;
+    std::pmr::unordered_map<int, Client*> clientMap;
+
+    // Recherche par nom complet et par prfixe du nom de famille
+    ClientNameIndex clientNames;
+
+    // Numro de compte <-> handle; accounts[handle] est le compte
+    AccountRegistry registry;
+
+    // Index client -> ses comptes (ordre d'ouverture)
+    std::pmr::unordered_map<int, std::pmr::vector<BankAccount*>> clientAccountIndex;
+
+    // Index handle -> positions de ses transactions dans transactions
+    std::vector<std::pmr::vector<size_t>> accountTransactions;
+
+    // Mode multi-thread: ordre des verrous = structureMutex -> rankingMutex
+    // -> comptes (par handle croissant) -> transactionsMutex
+    bool threadSafe;
+    mutable std::shared_mutex structureMutex;   // clients, accounts, maps
+    mutable std::mutex transactionsMutex;       // journal des transactions
+
+    // Journal binaire sur disque (optionnel)
+    std::unique_ptr<Journal> journal;
+
+    // Comptes en mode chaud (dpts sur sous-soldes par thread)
+    std::vector<AccountHandle> hotAccounts;
+
+    // Instantan en cours: un compte modifi aprs le gel garde, au premier
+    // changement, ses valeurs geles dans snapshotSlots[handle] (copie sur criture)
+    struct SnapshotSlot {
+        uint64_t epoch;
+        Money balance;
+        AccountStatus status;
+    };
+    std::vector<SnapshotSlot> snapshotSlots;
+    uint64_t snapshotEpoch;
+    std::atomic<size_t> snapshotAccounts;   // comptes gels, 0 hors instantan
+    std::atomic<bool> snapshotRunning;
+    bool snapshotResult;
+    std::mutex snapshotMutex;               // protge snapshotThread
+    std::thread snapshotThread;
+
+    // Soldes chargs d'un instantan (centimes, par handle), sans historique:
+    // point de dpart du rapprochement
+    std::vector<int64_t> baseBalances;
+
+    // Limites de vlocit des dbits, vrifies avec le reste de la validation
+    VelocityGuard velocity;
+
+    // Agrgats tenus  jour par les mutations
+    BankStatistics statistics;
+    bool statisticsCheck;   // recalcul et assert  chaque lecture (dbogage)
+
+    // Index bitmap: handles des comptes par type et par statut, identifiants
+    // des clients par type. bitmapMutex est pris en dernier, seul: sous le
+    // verrou d'un compte lors d'un changement de statut.
+    BitmapIndex accountsByType[BankStatistics::ACCOUNT_TYPE_COUNT];
+    BitmapIndex accountsByStatus[BankStatistics::ACCOUNT_STATUS_COUNT];
+    BitmapIndex clientsByType[BankStatistics::CLIENT_TYPE_COUNT];
+    mutable std::shared_mutex bitmapMutex;
+
+    // Classements: tous les comptes par solde, et les comptes les plus actifs
+    // par nombre exact de transactions (tenu  jour sous transactionsMutex).
+    // Le classement par solde est paresseux: une mutation ne fait que marquer
+    // le compte dans dirtyBalances (un bit par handle, sans verrou), et la
+    // lecture rordonne les comptes marqus sous rankingMutex. rankingMutex
+    // est pris avant les verrous des comptes, jamais sous l'un d'eux.
+    mutable IndexedHeap<std::greater<int64_t>> balanceRanking;
+    IndexedHeap<std::less<int64_t>> activityRanking;
+    mutable std::deque<std::atomic<uint64_t>> dirtyBalances;   // agrandi sous verrou exclusif
+    mutable std::mutex rankingMutex;
 
     // Mthodes auxiliaires
-    bool validateTransaction(const std::string& fromAccount,
-        const std::string& toAccount,
-        double amount) const;
-    void recordTransaction(const std::string& fromAccount,
-        const std::string& toAccount,
-        double amount,
-        TransactionType type);
+    std::shared_lock<std::shared_mutex> readLock() const;
+    std::unique_lock<std::shared_mutex> writeLock() const;
+    std::unique_lock<std::mutex> lockAccount(const BankAccount& account) const;
+    std::shared_lock<std::shared_mutex> bitmapReadLock() const;
+    std::unique_lock<std::shared_mutex> bitmapWriteLock() const;
+    BankAccount* lookupAccount(AccountHandle handle) const;
+    BankAccount* lookupAccount(const std::string& accountNumber) const;
+    Client* lookupClient(int clientId) const;
+    const std::pmr::vector<BankAccount*>& clientAccountList(int clientId) const;
+    TransactionRange accountHistory(AccountHandle handle) const;
+    std::shared_ptr<Client> share(Client* client) const;
+    std::shared_ptr<BankAccount> share(BankAccount* account) const;
+    OperationStatus checkTransaction(const BankAccount* fromAcc,
+        const BankAccount* toAcc,
+        Money amount,
+        int64_t now = 0) const;
+    void reportOperation(OperationStatus result,
+        TransactionType type,
+        AccountHandle fromAccount,
+        AccountHandle toAccount,
+        Money amount) const;
+    void recordTransaction(AccountHandle fromAccount,
+        AccountHandle toAccount,
+        Money amount,
+        TransactionType type,
+        JournalRecord record = JournalRecord());
+    size_t appendTransaction(AccountHandle fromAccount,
+        AccountHandle toAccount,
+        Money amount,
+        TransactionType type,
+        int32_t date,
+        JournalRecord& record);
+    void indexTransaction(size_t position);
+    void rankActivity(AccountHandle handle);
+    void refreshBalanceRanking() const;
+    OperationStatus stageBatchOperation(const BatchOperation& operation,
+        AccountHandle& fromAccount,
+        AccountHandle& toAccount,
+        std::unordered_map<AccountHandle, Money>& balances) const;
+    void journalStatusChange(const BankAccount& account, JournalRecordType type);
+    void replayRecord(const JournalRecord& record);
+    void attachAccount(BankAccount& account);
+    void onAccountChanged(const BankAccount& account,
+        Money oldBalance, Money newBalance, AccountStatus oldStatus) override;
+    void indexClient(Client& client);
+    void unindexClient(Client& client);
+    void onClientRenamed(const Client& client,
+        const std::string& oldFirstName, const std::string& oldLastName) override;
+    void checkStatistics() const;
+    void foldHotAccounts() const;
+    void foldHotAccountsLocked() const;
+    bool writeSnapshot(const std::string& filename, const SnapshotHeader& header,
+        const std::vector<SnapshotClientRecord>& clientRecords, size_t accountCount);
 
 public:
     // Constructeur
     Bank(const std::string& name = "Banque", const std::string& bankCode = "001");
+    ~Bank();
 
     // Gestion des clients
     int addClient(const std::string& firstName, const std::string& lastName,
         const Address& address, ClientType type = ClientType::REGULAR);
     bool removeClient(int clientId);
     std::shared_ptr<Client> findClient(int clientId) const;
+    // Par index, sans tenir compte de la casse ni des espaces superflus
     std::shared_ptr<Client> findClient(const std::string& firstName,
         const std::string& lastName) const;
+    // Recherche  la saisie: au plus limit clients, par ordre alphabtique
+    std::vector<std::shared_ptr<Client>> findClientsByLastNamePrefix(const std::string& prefix,
+        size_t limit = 20) const;
     std::vector<std::shared_ptr<Client>> getAllClients() const;
     std::vector<std::shared_ptr<Client>> getClientsByType(ClientType type) const;
+    // Nom chang et rindex sous un seul verrou exclusif. En mode
+    // multi-thread, ne pas appeler Client::setFirstName / setLastName: le nom
+    // changerait sans verrou pendant une recherche.
+    bool renameClient(int clientId, const std::string& firstName, const std::string& lastName);
+
+    // Accs direct, sans compteur de rfrences ni allocation. Un client ou un
+    // compte reste  la mme adresse tant que la banque existe, mme supprim.
+    Client* getClient(int clientId) const;
+    // Valide jusqu'au prochain ajout ou suppression de client
+    std::span<Client* const> getClientsView() const;
 
     // Gestion des comptes
-    std::string openAccount(int clientId, AccountType type, double initialBalance = 0.0);
+    std::string openAccount(int clientId, AccountType type, Money initialBalance = Money());
     bool closeAccount(const std::string& accountNumber);
+    // Gel et ractivation sous verrou exclusif, inscrits au journal
+    // (BankAccount::freeze / activate appels directement y chappent)
+    OperationStatus tryFreezeAccount(AccountHandle account);
+    OperationStatus tryActivateAccount(AccountHandle account);
     std::shared_ptr<BankAccount> findAccount(const std::string& accountNumber) const;
+    std::shared_ptr<BankAccount> findAccount(AccountHandle handle) const;
+    AccountHandle getAccountHandle(const std::string& accountNumber) const;
+    const std::string& getAccountNumber(AccountHandle handle) const;
     std::vector<std::shared_ptr<BankAccount>> getClientAccounts(int clientId) const;
     std::vector<std::shared_ptr<BankAccount>> getAllAccounts() const;
     std::vector<std::shared_ptr<BankAccount>> getAccountsByType(AccountType type) const;
 
-    // Oprations bancaires
-    bool deposit(const std::string& accountNumber, double amount);
-    bool withdraw(const std::string& accountNumber, double amount);
-    bool transfer(const std::string& fromAccount, const std::string& toAccount, double amount);
+    // Accs direct aux comptes, comme getClient
+    BankAccount* getAccount(AccountHandle handle) const;
+    BankAccount* getAccount(const std::string& accountNumber) const;
+    // Sans allocation; valides jusqu' la prochaine ouverture de compte
+    std::span<BankAccount* const> getClientAccountsView(int clientId) const;
+    std::span<BankAccount* const> getAccountsView() const;
+
+    // Vues paresseuses filtres (std::views::filter sur les vues ci-dessus):
+    // ni allocation ni compteur de rfrences. Les filtres se composent:
+    // getAccountsView(filters::accountType(AccountType::SAVINGS)
+    //     && filters::minBalance(Money(100.0)))
+    // Mme validit que les vues sans filtre. Le filtre est valu pendant
+    // le parcours, sans verrou: en mode multi-thread, les oprations doivent
+    // tre suspendues.
+    template <class Test>
+    auto getClientsView(const BankFilter<Test>& filter) const {
+        return getClientsView() | std::views::filter(filter);
+    }
+    template <class Test>
+    auto getAccountsView(const BankFilter<Test>& filter) const {
+        return getAccountsView() | std::views::filter(filter);
+    }
+    template <class Test>
+    auto getClientAccountsView(int clientId, const BankFilter<Test>& filter) const {
+        return getClientAccountsView(clientId) | std::views::filter(filter);
+    }
+
+    // Oprations bancaires (messages envoys  EventSink::active())
+    bool deposit(const std::string& accountNumber, Money amount);
+    bool withdraw(const std::string& accountNumber, Money amount);
+    bool transfer(const std::string& fromAccount, const std::string& toAccount, Money amount);
+
+    // Mmes oprations par handle, sans recherche de chane
+    bool deposit(AccountHandle account, Money amount);
+    bool withdraw(AccountHandle account, Money amount);
+    bool transfer(AccountHandle fromAccount, AccountHandle toAccount, Money amount);
+
+    // Variantes silencieuses: statut dtaill, aucun message ni vidage de flux
+    OperationStatus tryDeposit(AccountHandle account, Money amount);
+    OperationStatus tryWithdraw(AccountHandle account, Money amount);
+    OperationStatus tryTransfer(AccountHandle fromAccount, AccountHandle toAccount, Money amount);
+
+    // Lot de rglement, tout ou rien et sans message: statuses[i] est le
+    // rsultat de operations[i]. Retourne false si rien n'a t appliqu.
+    bool applyBatch(const std::vector<BatchOperation>& operations,
+        std::vector<OperationStatus>& statuses);
+
+    // Intrts et frais des comptes pargne actifs, en une passe sur une
+    // colonne dense des soldes; transactions INTEREST et FEE ajoutes en bloc
+    InterestSummary applyInterest(const InterestSchedule& schedule);
 
     // Affichage des informations
     void displayBankInfo() const;
@@ -69,20 +330,108 @@ public:
     void displayTransactionHistory() const;
     void displayAccountTransactions(const std::string& accountNumber) const;
 
-    // Statistiques
+    // Rapports CSV ou JSON (ReportWriter): lignes formates en parallle par
+    // tranches de comptes (ou de transactions), crites dans l'ordre sur out.
+    // threads = 0: un par coeur. false si l'criture a chou.
+    bool exportClients(std::ostream& out, ReportFormat format, unsigned threads = 0) const;
+    bool exportAccounts(std::ostream& out, ReportFormat format, unsigned threads = 0) const;
+    bool exportTransactions(std::ostream& out, ReportFormat format, unsigned threads = 0) const;
+    // Relevs: chaque compte avec son historique. Les oprations attendent
+    // la fin du rapport (verrou exclusif), pour des soldes cohrents.
+    bool exportStatements(std::ostream& out, ReportFormat format, unsigned threads = 0) const;
+    bool exportAccountStatement(const std::string& accountNumber, std::ostream& out,
+        ReportFormat format) const;
+
+    // Historique d'un compte, en O(nombre de ses transactions)
+    TransactionRange getAccountTransactions(const std::string& accountNumber) const;
+    TransactionRange getAccountTransactions(AccountHandle handle) const;
+
+    // Transactions dates de from  to inclus, par date puis ordre d'ajout.
+    // Seules les partitions (par jour) de la priode sont lues.
+    std::vector<Transaction> getTransactions(const Date& from, const Date& to) const;
+    std::vector<Transaction> getAccountTransactions(const std::string& accountNumber,
+        const Date& from, const Date& to) const;
+    std::vector<Transaction> getAccountTransactions(AccountHandle handle,
+        const Date& from, const Date& to) const;
+
+    // Statistiques (O(1), sans parcours). Les dpts des comptes chauds ne
+    // notifient pas la banque: les totaux les versent d'abord (foldHotAccounts)
     int getTotalClients() const;
     int getTotalAccounts() const;
     int getActiveAccountsCount() const;
     int getPremiumClientsCount() const;
-    double getTotalBankBalance() const;
+    Money getTotalBankBalance() const;
+    int getAccountsCount(AccountType type) const;
+    int getAccountsCount(AccountStatus status) const;
+    Money getTotalBalance(AccountType type) const;
+    Money getTotalBalance(AccountStatus status) const;
+    Money getTransactionTotal(TransactionType type) const;
+
+    // Index bitmap (BitmapIndex), tenus  jour  l'ouverture,  la suppression
+    // d'un client et  chaque changement de statut: comptes et intersections
+    // sans parcourir les comptes. Les bitmaps retourns sont des copies.
+    int getAccountsCount(AccountType type, AccountStatus status) const;
+    int getClientsCount(ClientType type) const;
+    BitmapIndex getAccountBitmap(AccountType type) const;      // handles
+    BitmapIndex getAccountBitmap(AccountStatus status) const;  // handles
+    BitmapIndex getClientBitmap(ClientType type) const;        // identifiants
+
+    // Classements sans parcours ni tri des comptes, en O(n log n) pour n
+    // petit. Soldes: tous les comptes, quel que soit leur statut. Activit:
+    // transactions de chaque compte, au plus ACTIVITY_RANKING_SIZE comptes.
+    static constexpr size_t ACTIVITY_RANKING_SIZE = 100;
+    std::vector<RankedAccount> getTopBalances(size_t n) const;
+    std::vector<RankedAccount> getMostActiveAccounts(size_t n) const;
+
+    // Vrification: recalcule les agrgats par un parcours complet
+    bool verifyStatistics() const;
+    void setStatisticsCheck(bool enabled);
+
+    // Rapprochement: rejoue toutes les transactions (ReconciliationEngine) et
+    // compare chaque solde  son historique. Soldes et historique sont relevs
+    // ensemble sous verrou exclusif, puis rejous sans bloquer les oprations.
+    ReconciliationReport reconcile(unsigned threads = 0) const;
 
     // Getters
     std::string getName() const;
     std::string getBankCode() const;
 
+    // Mode multi-thread (dsactiv par dfaut)
+    void setThreadSafe(bool enabled);
+    bool isThreadSafe() const;
+
+    // Limites de vlocit des retraits et transferts (dsactives par dfaut).
+    // Les lots et les intrts n'y sont pas soumis.
+    void setVelocityLimits(const VelocityLimits& limits);
+    VelocityLimits getVelocityLimits() const;
+
+    // Compte marchand trs sollicit: les dpts ne prennent plus son verrou
+    bool setHotAccount(const std::string& accountNumber, bool enabled);
+
     // Sauvegarde et chargement
     bool saveToFile(const std::string& filename) const;
     bool loadFromFile(const std::string& filename);
+
+    // Journal binaire: chaque opration y est ajoute, fsync group.
+    // S'ouvre sur une banque vide (false sinon). Pour continuer un journal
+    // existant: openJournal puis recoverFromJournal du mme fichier (la
+    // reprise n'crit rien dans le journal).
+    bool openJournal(const std::string& filename, int commitIntervalMs = 5);
+    void closeJournal();
+    // Attend que toutes les oprations dj faites soient sur disque.
+    // false sans journal ouvert, ou si une criture du journal a chou.
+    bool flushJournal();
+    // Reconstruit une banque vide  partir d'un journal
+    bool recoverFromJournal(const std::string& filename);
+
+    // Instantan binaire: gel cohrent sous verrou exclusif (copie des clients,
+    // sans copie des comptes), puis criture en arrire-plan pendant que les
+    // oprations continuent. Sans mode multi-thread, l'criture est immdiate.
+    // false si un instantan est dj en cours.
+    bool startSnapshot(const std::string& filename);
+    bool waitSnapshot();   // false si l'criture a chou
+    // Recharge une banque vide depuis un instantan projet en mmoire
+    bool loadSnapshot(const std::string& filename);
 };
 
 #endif // BANK_H
\ No newline at end of file
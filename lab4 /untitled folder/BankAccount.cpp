@@ -1,23 +1,38 @@
 ﻿#include "BankAccount.h"
+#include "EventSink.h"
+#include "IdService.h"
+#include <sstream>
 
 // Инициализация статического счётчика
-int BankAccount::accountCounter = 0;
+std::atomic<int> BankAccount::accountCounter(0);
 
 // Конструкторы
 BankAccount::BankAccount()
-    : accountNumber(generateAccountNumber()), clientId(0), balance(0.0),
-    type(AccountType::CHECKING), status(AccountStatus::ACTIVE) {
+    : accountNumber(generateAccountNumber()), handle(NO_ACCOUNT), clientId(0), balance(),
+    type(AccountType::CHECKING), status(AccountStatus::ACTIVE), observer(nullptr) {
     openingDate = Date::getCurrentDate();
     accountCounter++;
 }
 
-BankAccount::BankAccount(int clientId, AccountType type, double initialBalance)
-    : accountNumber(generateAccountNumber()), clientId(clientId),
-    balance(initialBalance), type(type), status(AccountStatus::ACTIVE) {
+BankAccount::BankAccount(int clientId, AccountType type, Money initialBalance)
+    : accountNumber(generateAccountNumber()), handle(NO_ACCOUNT), clientId(clientId),
+    balance(initialBalance), type(type), status(AccountStatus::ACTIVE), observer(nullptr) {
     openingDate = Date::getCurrentDate();
     accountCounter++;
 }
 
+BankAccount::BankAccount(const std::string& accountNumber, int clientId, AccountType type,
+    Money balance, const Date& openingDate)
+    : accountNumber(accountNumber), handle(NO_ACCOUNT), clientId(clientId),
+    balance(balance), type(type), openingDate(openingDate), status(AccountStatus::ACTIVE),
+    observer(nullptr) {
+    accountCounter++;
+    int64_t id = IdService::parseAccountNumber(accountNumber);
+    if (id >= 0) {
+        IdService::advancePast(IdKind::ACCOUNT, id);
+    }
+}
+
 // Деструктор
 BankAccount::~BankAccount() {
     accountCounter--;
@@ -25,8 +40,13 @@ BankAccount::~BankAccount() {
 
 // Геттеры
 std::string BankAccount::getAccountNumber() const { return accountNumber; }
+AccountHandle BankAccount::getHandle() const { return handle; }
+void BankAccount::setHandle(AccountHandle handle) { this->handle = handle; }
 int BankAccount::getClientId() const { return clientId; }
-double BankAccount::getBalance() const { return balance; }
+Money BankAccount::getBalance() const {
+    // Для горячего счёта — с учётом ещё не сложенных взносов
+    return stripes ? balance + Money::fromCents(stripes->pending()) : balance;
+}
 AccountType BankAccount::getType() const { return type; }
 Date BankAccount::getOpeningDate() const { return openingDate; }
 AccountStatus BankAccount::getStatus() const { return status; }
@@ -48,99 +68,299 @@ std::string BankAccount::getStatusString() const {
     }
 }
 
-// Операции со счётом
-bool BankAccount::deposit(double amount) {
-    if (amount <= 0) {
-        std::cout << "Сумма для внесения должна быть положительной!" << std::endl;
-        return false;
+// Операции со счётом (без вывода)
+OperationStatus BankAccount::tryDeposit(Money amount) {
+    if (amount <= Money()) {
+        return OperationStatus::INVALID_AMOUNT;
+    }
+
+    if (stripes) {
+        // Горячий счёт: в локальную полосу, без блокировки и уведомления
+        return stripes->add(amount.getCents()) ? OperationStatus::OK : OperationStatus::INACTIVE;
     }
 
     if (status != AccountStatus::ACTIVE) {
-        std::cout << "Счёт не активен!" << std::endl;
-        return false;
+        return OperationStatus::INACTIVE;
     }
 
+    Money oldBalance = balance;
     balance += amount;
-    std::cout << "Успешно внесено " << amount << " на счёт " << accountNumber << std::endl;
-    return true;
+    notifyChanged(oldBalance, status);
+    return OperationStatus::OK;
 }
 
-bool BankAccount::withdraw(double amount) {
-    if (amount <= 0) {
-        std::cout << "Сумма для снятия должна быть положительной!" << std::endl;
-        return false;
+OperationStatus BankAccount::tryWithdraw(Money amount) {
+    if (amount <= Money()) {
+        return OperationStatus::INVALID_AMOUNT;
     }
 
+    // Сначала собрать взносы: проверка идёт по полному балансу
+    foldStripes();
+
     if (status != AccountStatus::ACTIVE) {
-        std::cout << "Счёт не активен!" << std::endl;
-        return false;
+        return OperationStatus::INACTIVE;
     }
 
     if (!canWithdraw(amount)) {
-        std::cout << "Недостаточно средств на счёте!" << std::endl;
-        return false;
+        return OperationStatus::INSUFFICIENT_FUNDS;
     }
 
+    Money oldBalance = balance;
     balance -= amount;
-    std::cout << "Успешно снято " << amount << " со счёта " << accountNumber << std::endl;
-    return true;
+    notifyChanged(oldBalance, status);
+    return OperationStatus::OK;
 }
 
-bool BankAccount::transfer(BankAccount& targetAccount, double amount) {
+OperationStatus BankAccount::tryTransfer(BankAccount& targetAccount, Money amount) {
     if (this == &targetAccount) {
-        std::cout << "Нельзя перевести средства на тот же счёт!" << std::endl;
-        return false;
+        return OperationStatus::INVALID_OPERATION;
+    }
+
+    OperationStatus result = tryWithdraw(amount);
+    if (result != OperationStatus::OK) {
+        return result;
+    }
+
+    result = targetAccount.tryDeposit(amount);
+    if (result != OperationStatus::OK) {
+        // Возвращаем средства, если депозит не удался
+        tryDeposit(amount);
+    }
+    return result;
+}
+
+OperationStatus BankAccount::tryActivate() {
+    if (status == AccountStatus::CLOSED && balance != Money()) {
+        return OperationStatus::NON_ZERO_BALANCE;
+    }
+
+    AccountStatus oldStatus = status;
+    status = AccountStatus::ACTIVE;
+    updateStripes();
+    notifyChanged(balance, oldStatus);
+    return OperationStatus::OK;
+}
+
+OperationStatus BankAccount::tryClose() {
+    if (stripes) {
+        stripes->close();
+        foldStripes();
     }
 
-    if (withdraw(amount)) {
-        if (targetAccount.deposit(amount)) {
-            return true;
+    if (balance != Money()) {
+        updateStripes();
+        return OperationStatus::NON_ZERO_BALANCE;
+    }
+
+    AccountStatus oldStatus = status;
+    status = AccountStatus::CLOSED;
+    notifyChanged(balance, oldStatus);
+    return OperationStatus::OK;
+}
+
+OperationStatus BankAccount::tryFreeze() {
+    if (stripes) {
+        stripes->close();
+        foldStripes();
+    }
+
+    AccountStatus oldStatus = status;
+    status = AccountStatus::FROZEN;
+    notifyChanged(balance, oldStatus);
+    return OperationStatus::OK;
+}
+
+// Операции со счётом (сообщения в EventSink)
+bool BankAccount::deposit(Money amount) {
+    OperationStatus result = tryDeposit(amount);
+    if (EventSink* sink = EventSink::active()) {
+        std::stringstream ss;
+        switch (result) {
+        case OperationStatus::OK:
+            ss << "Успешно внесено " << amount << " на счёт " << accountNumber;
+            break;
+        case OperationStatus::INVALID_AMOUNT:
+            ss << "Сумма для внесения должна быть положительной!";
+            break;
+        default:
+            ss << "Счёт не активен!";
+            break;
         }
-        else {
-            // Возвращаем средства, если депозит не удался
-            deposit(amount);
-            return false;
+        sink->emit(ss.str());
+    }
+    return result == OperationStatus::OK;
+}
+
+bool BankAccount::withdraw(Money amount) {
+    OperationStatus result = tryWithdraw(amount);
+    if (EventSink* sink = EventSink::active()) {
+        std::stringstream ss;
+        switch (result) {
+        case OperationStatus::OK:
+            ss << "Успешно снято " << amount << " со счёта " << accountNumber;
+            break;
+        case OperationStatus::INVALID_AMOUNT:
+            ss << "Сумма для снятия должна быть положительной!";
+            break;
+        case OperationStatus::INSUFFICIENT_FUNDS:
+            ss << "Недостаточно средств на счёте!";
+            break;
+        default:
+            ss << "Счёт не активен!";
+            break;
+        }
+        sink->emit(ss.str());
+    }
+    return result == OperationStatus::OK;
+}
+
+bool BankAccount::transfer(BankAccount& targetAccount, Money amount) {
+    OperationStatus result = tryTransfer(targetAccount, amount);
+    if (EventSink* sink = EventSink::active()) {
+        std::stringstream ss;
+        switch (result) {
+        case OperationStatus::OK:
+            ss << "Успешно переведено " << amount << " со счёта " << accountNumber
+                << " на счёт " << targetAccount.accountNumber;
+            break;
+        case OperationStatus::INVALID_OPERATION:
+            ss << "Нельзя перевести средства на тот же счёт!";
+            break;
+        case OperationStatus::INVALID_AMOUNT:
+            ss << "Сумма для перевода должна быть положительной!";
+            break;
+        case OperationStatus::INSUFFICIENT_FUNDS:
+            ss << "Недостаточно средств на счёте!";
+            break;
+        default:
+            ss << "Счёт не активен!";
+            break;
         }
+        sink->emit(ss.str());
     }
-    return false;
+    return result == OperationStatus::OK;
 }
 
 // Управление статусом счёта
 bool BankAccount::activate() {
-    if (status == AccountStatus::CLOSED && balance != 0) {
-        std::cout << "Нельзя активировать закрытый счёт с ненулевым балансом!" << std::endl;
-        return false;
+    OperationStatus result = tryActivate();
+    if (EventSink* sink = EventSink::active()) {
+        if (result == OperationStatus::OK) {
+            sink->emit("Счёт " + accountNumber + " активирован");
+        }
+        else {
+            sink->emit("Нельзя активировать закрытый счёт с ненулевым балансом!");
+        }
     }
-
-    status = AccountStatus::ACTIVE;
-    std::cout << "Счёт " << accountNumber << " активирован" << std::endl;
-    return true;
+    return result == OperationStatus::OK;
 }
 
 bool BankAccount::close() {
-    if (balance != 0) {
-        std::cout << "Нельзя закрыть счёт с ненулевым балансом!" << std::endl;
-        return false;
+    OperationStatus result = tryClose();
+    if (EventSink* sink = EventSink::active()) {
+        if (result == OperationStatus::OK) {
+            sink->emit("Счёт " + accountNumber + " закрыт");
+        }
+        else {
+            sink->emit("Нельзя закрыть счёт с ненулевым балансом!");
+        }
     }
-
-    status = AccountStatus::CLOSED;
-    std::cout << "Счёт " << accountNumber << " закрыт" << std::endl;
-    return true;
+    return result == OperationStatus::OK;
 }
 
 bool BankAccount::freeze() {
-    status = AccountStatus::FROZEN;
-    std::cout << "Счёт " << accountNumber << " заморожен" << std::endl;
+    tryFreeze();
+    if (EventSink* sink = EventSink::active()) {
+        sink->emit("Счёт " + accountNumber + " заморожен");
+    }
     return true;
 }
 
+// Восстановление состояния (повтор журнала)
+void BankAccount::restore(Money balance, AccountStatus status) {
+    if (stripes) {
+        stripes->close();
+        foldStripes();
+    }
+
+    Money oldBalance = this->balance;
+    AccountStatus oldStatus = this->status;
+    this->balance = balance;
+    this->status = status;
+    updateStripes();
+    notifyChanged(oldBalance, oldStatus);
+}
+
 // Проверки
 bool BankAccount::isActive() const {
     return status == AccountStatus::ACTIVE;
 }
 
-bool BankAccount::canWithdraw(double amount) const {
-    return balance >= amount;
+bool BankAccount::canWithdraw(Money amount) const {
+    return getBalance() >= amount;
+}
+
+// Синхронизация
+std::mutex& BankAccount::getMutex() const {
+    return mutex;
+}
+
+// Наблюдатель (Bank ведёт по нему свою статистику)
+void BankAccount::setObserver(AccountObserver* observer) {
+    this->observer = observer;
+}
+
+void BankAccount::notifyChanged(Money oldBalance, AccountStatus oldStatus) {
+    if (observer) {
+        observer->onAccountChanged(*this, oldBalance, balance, oldStatus);
+    }
+}
+
+// Горячий счёт: взносы копятся в полосах по потокам
+void BankAccount::setHot(bool enabled) {
+    if (enabled == isHot()) {
+        return;
+    }
+
+    if (enabled) {
+        stripes = std::make_unique<StripedBalance>(status == AccountStatus::ACTIVE);
+    }
+    else {
+        stripes->close();
+        foldStripes();
+        stripes.reset();
+    }
+}
+
+bool BankAccount::isHot() const {
+    return stripes != nullptr;
+}
+
+void BankAccount::foldStripes() {
+    if (!stripes) {
+        return;
+    }
+
+    int64_t cents = stripes->drain();
+    if (cents != 0) {
+        Money oldBalance = balance;
+        balance += Money::fromCents(cents);
+        notifyChanged(oldBalance, status);
+    }
+}
+
+// Взносы принимаются только активным счётом
+void BankAccount::updateStripes() {
+    if (!stripes) {
+        return;
+    }
+
+    if (status == AccountStatus::ACTIVE) {
+        stripes->open();
+    }
+    else {
+        stripes->close();
+    }
 }
 
 // Методы вывода информации
@@ -149,7 +369,7 @@ void BankAccount::displayInfo() const {
     std::cout << "Номер счёта: " << accountNumber << std::endl;
     std::cout << "Владелец (ID): " << clientId << std::endl;
     std::cout << "Тип счёта: " << getTypeString() << std::endl;
-    std::cout << "Баланс: " << balance << " руб." << std::endl;
+    std::cout << "Баланс: " << getBalance() << " руб." << std::endl;
     std::cout << "Статус: " << getStatusString() << std::endl;
     std::cout << "Дата открытия: ";
     openingDate.display();
@@ -159,15 +379,13 @@ void BankAccount::displayInfo() const {
 std::string BankAccount::toString() const {
     std::stringstream ss;
     ss << "Счёт " << accountNumber << " (Владелец: " << clientId
-        << ", Баланс: " << balance << " руб., Статус: " << getStatusString() << ")";
+        << ", Баланс: " << getBalance() << " руб., Статус: " << getStatusString() << ")";
     return ss.str();
 }
 
 // Статические методы
 std::string BankAccount::generateAccountNumber() {
-    std::stringstream ss;
-    ss << "ACC" << std::setw(7) << std::setfill('0') << (1000 + accountCounter);
-    return ss.str();
+    return IdService::formatAccountNumber(IdService::next(IdKind::ACCOUNT));
 }
 
 int BankAccount::getTotalAccounts() { return accountCounter; }
@@ -3,10 +3,16 @@
 #define BANKACCOUNT_H
 
 #include "Date.h"
+#include "Money.h"
+#include "AccountRegistry.h"
+#include "OperationStatus.h"
+#include "StripedBalance.h"
 #include <string>
 #include <iostream>
 #include <memory>
 #include <iomanip>
+#include <mutex>
+#include <atomic>
 
 // numrations doivent tre dclares AVANT la classe
 enum class AccountType {
@@ -20,48 +26,102 @@ enum class AccountStatus {
     FROZEN
 };
 
+class BankAccount;
+
+// Notifi aprs chaque changement de solde ou de statut d'un compte
+// (appel sous le verrou du compte). oldBalance et newBalance sont le solde
+// vers, sans les dpts encore dans les tranches d'un compte chaud: ceux-ci
+// peuvent arriver  tout moment et ne comptent qu'une fois verss.
+class AccountObserver {
+public:
+    virtual ~AccountObserver() = default;
+    virtual void onAccountChanged(const BankAccount& account,
+        Money oldBalance, Money newBalance, AccountStatus oldStatus) = 0;
+};
+
 class BankAccount {
 private:
     std::string accountNumber;
+    AccountHandle handle;   // attribu par Bank  l'ouverture
     int clientId;
-    double balance;
+    Money balance;
     AccountType type;
     Date openingDate;
     AccountStatus status;
 
-    static int accountCounter; // Compteur statique
+    // Verrou du compte, pris par Bank en mode multi-thread
+    mutable std::mutex mutex;
+
+    AccountObserver* observer;  // Bank, ou nullptr
+
+    // Mode  compte chaud : dpts sans verrou, verss au solde par foldStripes()
+    std::unique_ptr<StripedBalance> stripes;
+
+    void notifyChanged(Money oldBalance, AccountStatus oldStatus);
+    void updateStripes();
+
+    static std::atomic<int> accountCounter; // Comptes existants, toutes banques confondues
 
 public:
     // Constructeurs
     BankAccount();
-    BankAccount(int clientId, AccountType type, double initialBalance = 0.0);
+    BankAccount(int clientId, AccountType type, Money initialBalance = Money());
+    // Reprise avec un numro existant (journal): les numros suivants seront plus grands
+    BankAccount(const std::string& accountNumber, int clientId, AccountType type,
+        Money balance, const Date& openingDate);
 
     // Destructeur
     ~BankAccount();
 
     // Getters
     std::string getAccountNumber() const;
+    AccountHandle getHandle() const;
+    void setHandle(AccountHandle handle);
     int getClientId() const;
-    double getBalance() const;
+    Money getBalance() const;
     AccountType getType() const;
     std::string getTypeString() const;
     Date getOpeningDate() const;
     AccountStatus getStatus() const;
     std::string getStatusString() const;
 
-    // Oprations
-    bool deposit(double amount);
-    bool withdraw(double amount);
-    bool transfer(BankAccount& targetAccount, double amount);
+    // Oprations (messages envoys  EventSink::active())
+    bool deposit(Money amount);
+    bool withdraw(Money amount);
+    bool transfer(BankAccount& targetAccount, Money amount);
 
-    // Gestion du statut
+    // Gestion du statut. Pour un compte d'une banque, passer par
+    // Bank::tryFreezeAccount / tryActivateAccount: verrou et journal.
     bool activate();
     bool close();
     bool freeze();
 
+    // Mmes oprations sans aucun message
+    OperationStatus tryDeposit(Money amount);
+    OperationStatus tryWithdraw(Money amount);
+    OperationStatus tryTransfer(BankAccount& targetAccount, Money amount);
+    OperationStatus tryActivate();
+    OperationStatus tryClose();
+    OperationStatus tryFreeze();
+
+    // Reprise: remplace l'tat sans contrle ni message
+    void restore(Money balance, AccountStatus status);
+
     // Vrifications
     bool isActive() const;
-    bool canWithdraw(double amount) const;
+    bool canWithdraw(Money amount) const;
+
+    // Synchronisation
+    std::mutex& getMutex() const;
+
+    // Observateur des changements
+    void setObserver(AccountObserver* observer);
+
+    // Compte chaud: tryDeposit n'exige plus le verrou du compte. Les autres
+    // oprations le gardent. setHot n'est appel qu'en l'absence de dpts.
+    void setHot(bool enabled);
+    bool isHot() const;
+    void foldStripes(); // verse les dpts en attente dans le solde (sous verrou)
 
     // Affichage
     void displayInfo() const;
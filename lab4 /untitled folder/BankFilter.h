@@ -0,0 +1,78 @@
+#pragma once
+#ifndef BANKFILTER_H
+#define BANKFILTER_H
+
+#include "Client.h"
+#include "BankAccount.h"
+#include "Money.h"
+
+// Prédicat des vues filtrées de Bank, composable par &&, || et !.
+// Un simple objet valeur: ni std::function ni allocation, et l'appel se
+// fait sur le pointeur stocké par la banque, sans compteur de références.
+template <class Test>
+class BankFilter {
+private:
+    Test test;
+
+public:
+    constexpr explicit BankFilter(Test test) : test(test) {}
+
+    template <class T>
+    bool operator()(const T* object) const { return test(*object); }
+    template <class T>
+    bool matches(const T& object) const { return test(object); }
+};
+
+// Filtre quelconque: where([](const BankAccount& account) { ... })
+template <class Test>
+constexpr BankFilter<Test> where(Test test) {
+    return BankFilter<Test>(test);
+}
+
+template <class A, class B>
+constexpr auto operator&&(const BankFilter<A>& a, const BankFilter<B>& b) {
+    return where([a, b](const auto& object) { return a.matches(object) && b.matches(object); });
+}
+
+template <class A, class B>
+constexpr auto operator||(const BankFilter<A>& a, const BankFilter<B>& b) {
+    return where([a, b](const auto& object) { return a.matches(object) || b.matches(object); });
+}
+
+template <class A>
+constexpr auto operator!(const BankFilter<A>& a) {
+    return where([a](const auto& object) { return !a.matches(object); });
+}
+
+// Filtres usuels
+namespace filters {
+
+inline auto accountType(AccountType type) {
+    return where([type](const BankAccount& account) { return account.getType() == type; });
+}
+
+inline auto accountStatus(AccountStatus status) {
+    return where([status](const BankAccount& account) { return account.getStatus() == status; });
+}
+
+// Solde >= minimum
+inline auto minBalance(Money minimum) {
+    return where([minimum](const BankAccount& account) { return account.getBalance() >= minimum; });
+}
+
+// Solde < maximum
+inline auto maxBalance(Money maximum) {
+    return where([maximum](const BankAccount& account) { return account.getBalance() < maximum; });
+}
+
+inline auto ownedBy(int clientId) {
+    return where([clientId](const BankAccount& account) { return account.getClientId() == clientId; });
+}
+
+inline auto clientType(ClientType type) {
+    return where([type](const Client& client) { return client.getType() == type; });
+}
+
+}
+
+#endif // BANKFILTER_H
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "BankStatistics.h"
+#include <iostream>
+
+// Constructeur
+BankStatistics::BankStatistics() {
+    reset();
+}
+
+// Mises à jour
+void BankStatistics::clientAdded(ClientType type) {
+    clientCount.fetch_add(1, std::memory_order_relaxed);
+    if (type == ClientType::PREMIUM) {
+        premiumClientCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void BankStatistics::clientRemoved(ClientType type) {
+    clientCount.fetch_sub(1, std::memory_order_relaxed);
+    if (type == ClientType::PREMIUM) {
+        premiumClientCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void BankStatistics::accountAdded(AccountType type, AccountStatus status, Money balance) {
+    int64_t cents = balance.getCents();
+    accountCount.fetch_add(1, std::memory_order_relaxed);
+    totalBalance.fetch_add(cents, std::memory_order_relaxed);
+    accountsByType[(int)type].fetch_add(1, std::memory_order_relaxed);
+    balanceByType[(int)type].fetch_add(cents, std::memory_order_relaxed);
+    accountsByStatus[(int)status].fetch_add(1, std::memory_order_relaxed);
+    balanceByStatus[(int)status].fetch_add(cents, std::memory_order_relaxed);
+}
+
+void BankStatistics::accountChanged(AccountType type, Money oldBalance, AccountStatus oldStatus,
+    Money newBalance, AccountStatus newStatus) {
+    int64_t delta = newBalance.getCents() - oldBalance.getCents();
+    if (delta != 0) {
+        totalBalance.fetch_add(delta, std::memory_order_relaxed);
+        balanceByType[(int)type].fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    if (oldStatus == newStatus) {
+        if (delta != 0) {
+            balanceByStatus[(int)newStatus].fetch_add(delta, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    accountsByStatus[(int)oldStatus].fetch_sub(1, std::memory_order_relaxed);
+    balanceByStatus[(int)oldStatus].fetch_sub(oldBalance.getCents(), std::memory_order_relaxed);
+    accountsByStatus[(int)newStatus].fetch_add(1, std::memory_order_relaxed);
+    balanceByStatus[(int)newStatus].fetch_add(newBalance.getCents(), std::memory_order_relaxed);
+}
+
+void BankStatistics::reset() {
+    clientCount.store(0, std::memory_order_relaxed);
+    premiumClientCount.store(0, std::memory_order_relaxed);
+    accountCount.store(0, std::memory_order_relaxed);
+    totalBalance.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < ACCOUNT_TYPE_COUNT; i++) {
+        accountsByType[i].store(0, std::memory_order_relaxed);
+        balanceByType[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < ACCOUNT_STATUS_COUNT; i++) {
+        accountsByStatus[i].store(0, std::memory_order_relaxed);
+        balanceByStatus[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Lectures
+int BankStatistics::getClientCount() const {
+    return clientCount.load(std::memory_order_relaxed);
+}
+
+int BankStatistics::getPremiumClientCount() const {
+    return premiumClientCount.load(std::memory_order_relaxed);
+}
+
+int BankStatistics::getAccountCount() const {
+    return accountCount.load(std::memory_order_relaxed);
+}
+
+int BankStatistics::getAccountCount(AccountType type) const {
+    return accountsByType[(int)type].load(std::memory_order_relaxed);
+}
+
+int BankStatistics::getAccountCount(AccountStatus status) const {
+    return accountsByStatus[(int)status].load(std::memory_order_relaxed);
+}
+
+Money BankStatistics::getTotalBalance() const {
+    return Money::fromCents(totalBalance.load(std::memory_order_relaxed));
+}
+
+Money BankStatistics::getTotalBalance(AccountType type) const {
+    return Money::fromCents(balanceByType[(int)type].load(std::memory_order_relaxed));
+}
+
+Money BankStatistics::getTotalBalance(AccountStatus status) const {
+    return Money::fromCents(balanceByStatus[(int)status].load(std::memory_order_relaxed));
+}
+
+// Vérification
+bool BankStatistics::matches(const BankStatistics& other) const {
+    bool ok = true;
+    auto check = [&ok](const char* field, int64_t expected, int64_t actual) {
+        if (expected != actual) {
+            std::cout << "Statistique incoherente: " << field << " = " << actual
+                << " (attendu " << expected << ")" << std::endl;
+            ok = false;
+        }
+    };
+
+    check("clients", other.getClientCount(), getClientCount());
+    check("clients premium", other.getPremiumClientCount(), getPremiumClientCount());
+    check("comptes", other.getAccountCount(), getAccountCount());
+    check("solde total", other.getTotalBalance().getCents(), getTotalBalance().getCents());
+    for (int i = 0; i < ACCOUNT_TYPE_COUNT; i++) {
+        AccountType type = (AccountType)i;
+        check("comptes par type", other.getAccountCount(type), getAccountCount(type));
+        check("solde par type", other.getTotalBalance(type).getCents(),
+            getTotalBalance(type).getCents());
+    }
+    for (int i = 0; i < ACCOUNT_STATUS_COUNT; i++) {
+        AccountStatus status = (AccountStatus)i;
+        check("comptes par statut", other.getAccountCount(status), getAccountCount(status));
+        check("solde par statut", other.getTotalBalance(status).getCents(),
+            getTotalBalance(status).getCents());
+    }
+    return ok;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef BANKSTATISTICS_H
+#define BANKSTATISTICS_H
+
+#include "Client.h"
+#include "BankAccount.h"
+#include "Money.h"
+#include <atomic>
+#include <cstdint>
+
+// Agrégats de la banque tenus à jour à chaque mutation: lecture en O(1).
+// Compteurs atomiques car les soldes changent sous le seul verrou du compte.
+class BankStatistics {
+public:
+    static const int ACCOUNT_TYPE_COUNT = 2;
+    static const int ACCOUNT_STATUS_COUNT = 3;
+    static const int CLIENT_TYPE_COUNT = 2;
+
+private:
+    std::atomic<int> clientCount;
+    std::atomic<int> premiumClientCount;
+    std::atomic<int> accountCount;
+    std::atomic<int64_t> totalBalance;   // centimes
+    std::atomic<int> accountsByType[ACCOUNT_TYPE_COUNT];
+    std::atomic<int64_t> balanceByType[ACCOUNT_TYPE_COUNT];
+    std::atomic<int> accountsByStatus[ACCOUNT_STATUS_COUNT];
+    std::atomic<int64_t> balanceByStatus[ACCOUNT_STATUS_COUNT];
+
+public:
+    BankStatistics();
+
+    BankStatistics(const BankStatistics&) = delete;
+    BankStatistics& operator=(const BankStatistics&) = delete;
+
+    // Mises à jour
+    void clientAdded(ClientType type);
+    void clientRemoved(ClientType type);
+    void accountAdded(AccountType type, AccountStatus status, Money balance);
+    void accountChanged(AccountType type, Money oldBalance, AccountStatus oldStatus,
+        Money newBalance, AccountStatus newStatus);
+    void reset();
+
+    // Lectures
+    int getClientCount() const;
+    int getPremiumClientCount() const;
+    int getAccountCount() const;
+    int getAccountCount(AccountType type) const;
+    int getAccountCount(AccountStatus status) const;
+    Money getTotalBalance() const;
+    Money getTotalBalance(AccountType type) const;
+    Money getTotalBalance(AccountStatus status) const;
+
+    // Compare champ par champ; affiche les écarts
+    bool matches(const BankStatistics& other) const;
+};
+
+#endif // BANKSTATISTICS_H
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+#ifndef BATCHOPERATION_H
+#define BATCHOPERATION_H
+
+#include "Transaction.h"
+#include "Money.h"
+#include "OperationStatus.h"
+#include <string>
+
+// Une ligne d'un fichier de règlement. Seuls DEPOSIT (toAccount),
+// WITHDRAWAL (fromAccount) et TRANSFER (les deux) sont acceptés.
+struct BatchOperation {
+    TransactionType type;
+    std::string fromAccount;
+    std::string toAccount;
+    Money amount;
+};
+
+#endif // BATCHOPERATION_H
\ No newline at end of file
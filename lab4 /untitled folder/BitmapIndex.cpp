@@ -0,0 +1,327 @@
+#include "BitmapIndex.h"
+#include <algorithm>
+
+// Groupes
+bool BitmapIndex::Container::contains(uint16_t low) const {
+    if (isBitmap()) {
+        return (words[low >> 6] >> (low & 63)) & 1;
+    }
+    return std::binary_search(values.begin(), values.end(), low);
+}
+
+void BitmapIndex::Container::toBitmap() {
+    words.assign(WORD_COUNT, 0);
+    for (uint16_t low : values) {
+        words[low >> 6] |= (uint64_t)1 << (low & 63);
+    }
+    std::vector<uint16_t>().swap(values);
+}
+
+void BitmapIndex::Container::toArray() {
+    values.clear();
+    values.reserve(cardinality);
+    for (size_t w = 0; w < WORD_COUNT; w++) {
+        uint64_t word = words[w];
+        while (word != 0) {
+            values.push_back((uint16_t)(w * 64 + std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+    std::vector<uint64_t>().swap(words);
+}
+
+// Constructeur
+BitmapIndex::BitmapIndex() : count(0) {}
+
+BitmapIndex::Container* BitmapIndex::findContainer(uint16_t key) {
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+        [](const Container& container, uint16_t value) {
+            return container.key < value;
+        });
+    return (it != containers.end() && it->key == key) ? &*it : nullptr;
+}
+
+const BitmapIndex::Container* BitmapIndex::findContainer(uint16_t key) const {
+    return const_cast<BitmapIndex*>(this)->findContainer(key);
+}
+
+// Mise à jour
+bool BitmapIndex::add(uint32_t value) {
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+        [](const Container& container, uint16_t k) {
+            return container.key < k;
+        });
+    if (it == containers.end() || it->key != key) {
+        Container container;
+        container.key = key;
+        container.cardinality = 0;
+        it = containers.insert(it, std::move(container));
+    }
+
+    Container& container = *it;
+    if (container.isBitmap()) {
+        uint64_t& word = container.words[low >> 6];
+        uint64_t mask = (uint64_t)1 << (low & 63);
+        if (word & mask) {
+            return false;
+        }
+        word |= mask;
+    }
+    else {
+        auto position = std::lower_bound(container.values.begin(), container.values.end(), low);
+        if (position != container.values.end() && *position == low) {
+            return false;
+        }
+        container.values.insert(position, low);
+        if (container.values.size() > ARRAY_LIMIT) {
+            container.toBitmap();
+        }
+    }
+    container.cardinality++;
+    count++;
+    return true;
+}
+
+bool BitmapIndex::remove(uint32_t value) {
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+
+    Container* container = findContainer(key);
+    if (!container) {
+        return false;
+    }
+    if (container->isBitmap()) {
+        uint64_t& word = container->words[low >> 6];
+        uint64_t mask = (uint64_t)1 << (low & 63);
+        if (!(word & mask)) {
+            return false;
+        }
+        word &= ~mask;
+        container->cardinality--;
+        if (container->cardinality <= ARRAY_LIMIT) {
+            container->toArray();
+        }
+    }
+    else {
+        auto position = std::lower_bound(container->values.begin(), container->values.end(), low);
+        if (position == container->values.end() || *position != low) {
+            return false;
+        }
+        container->values.erase(position);
+        container->cardinality--;
+    }
+    count--;
+
+    if (container->cardinality == 0) {
+        containers.erase(containers.begin() + (container - containers.data()));
+    }
+    return true;
+}
+
+bool BitmapIndex::contains(uint32_t value) const {
+    const Container* container = findContainer((uint16_t)(value >> 16));
+    return container && container->contains((uint16_t)value);
+}
+
+void BitmapIndex::clear() {
+    containers.clear();
+    count = 0;
+}
+
+// Intersection et union, groupe par groupe
+uint64_t BitmapIndex::intersectionCount(const Container& a, const Container& b) {
+    if (a.isBitmap() && b.isBitmap()) {
+        uint64_t total = 0;
+        for (size_t w = 0; w < WORD_COUNT; w++) {
+            total += std::popcount(a.words[w] & b.words[w]);
+        }
+        return total;
+    }
+    if (a.isBitmap() || b.isBitmap()) {
+        const Container& array = a.isBitmap() ? b : a;
+        const Container& bitmap = a.isBitmap() ? a : b;
+        uint64_t total = 0;
+        for (uint16_t low : array.values) {
+            total += (bitmap.words[low >> 6] >> (low & 63)) & 1;
+        }
+        return total;
+    }
+
+    uint64_t total = 0;
+    auto i = a.values.begin();
+    auto j = b.values.begin();
+    while (i != a.values.end() && j != b.values.end()) {
+        if (*i < *j) {
+            ++i;
+        }
+        else if (*j < *i) {
+            ++j;
+        }
+        else {
+            total++;
+            ++i;
+            ++j;
+        }
+    }
+    return total;
+}
+
+BitmapIndex::Container BitmapIndex::intersect(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    result.cardinality = 0;
+
+    if (a.isBitmap() && b.isBitmap()) {
+        result.words.resize(WORD_COUNT);
+        for (size_t w = 0; w < WORD_COUNT; w++) {
+            result.words[w] = a.words[w] & b.words[w];
+            result.cardinality += std::popcount(result.words[w]);
+        }
+        if (result.cardinality <= ARRAY_LIMIT) {
+            result.toArray();
+        }
+        return result;
+    }
+    if (a.isBitmap() || b.isBitmap()) {
+        const Container& array = a.isBitmap() ? b : a;
+        const Container& bitmap = a.isBitmap() ? a : b;
+        for (uint16_t low : array.values) {
+            if ((bitmap.words[low >> 6] >> (low & 63)) & 1) {
+                result.values.push_back(low);
+            }
+        }
+    }
+    else {
+        std::set_intersection(a.values.begin(), a.values.end(),
+            b.values.begin(), b.values.end(), std::back_inserter(result.values));
+    }
+    result.cardinality = (uint32_t)result.values.size();
+    return result;
+}
+
+BitmapIndex::Container BitmapIndex::unite(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    result.cardinality = 0;
+
+    if (!a.isBitmap() && !b.isBitmap() && a.cardinality + b.cardinality <= ARRAY_LIMIT) {
+        std::set_union(a.values.begin(), a.values.end(),
+            b.values.begin(), b.values.end(), std::back_inserter(result.values));
+        result.cardinality = (uint32_t)result.values.size();
+        return result;
+    }
+
+    result.words.assign(WORD_COUNT, 0);
+    for (const Container* source : { &a, &b }) {
+        if (source->isBitmap()) {
+            for (size_t w = 0; w < WORD_COUNT; w++) {
+                result.words[w] |= source->words[w];
+            }
+        }
+        else {
+            for (uint16_t low : source->values) {
+                result.words[low >> 6] |= (uint64_t)1 << (low & 63);
+            }
+        }
+    }
+    for (size_t w = 0; w < WORD_COUNT; w++) {
+        result.cardinality += std::popcount(result.words[w]);
+    }
+    if (result.cardinality <= ARRAY_LIMIT) {
+        result.toArray();
+    }
+    return result;
+}
+
+uint64_t BitmapIndex::intersectionCount(const BitmapIndex& a, const BitmapIndex& b) {
+    uint64_t total = 0;
+    auto i = a.containers.begin();
+    auto j = b.containers.begin();
+    while (i != a.containers.end() && j != b.containers.end()) {
+        if (i->key < j->key) {
+            ++i;
+        }
+        else if (j->key < i->key) {
+            ++j;
+        }
+        else {
+            total += intersectionCount(*i, *j);
+            ++i;
+            ++j;
+        }
+    }
+    return total;
+}
+
+BitmapIndex BitmapIndex::operator&(const BitmapIndex& other) const {
+    BitmapIndex result;
+    auto i = containers.begin();
+    auto j = other.containers.begin();
+    while (i != containers.end() && j != other.containers.end()) {
+        if (i->key < j->key) {
+            ++i;
+        }
+        else if (j->key < i->key) {
+            ++j;
+        }
+        else {
+            Container container = intersect(*i, *j);
+            if (container.cardinality > 0) {
+                result.count += container.cardinality;
+                result.containers.push_back(std::move(container));
+            }
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+BitmapIndex BitmapIndex::operator|(const BitmapIndex& other) const {
+    BitmapIndex result;
+    auto i = containers.begin();
+    auto j = other.containers.begin();
+    while (i != containers.end() || j != other.containers.end()) {
+        if (j == other.containers.end() || (i != containers.end() && i->key < j->key)) {
+            result.containers.push_back(*i++);
+        }
+        else if (i == containers.end() || j->key < i->key) {
+            result.containers.push_back(*j++);
+        }
+        else {
+            result.containers.push_back(unite(*i, *j));
+            ++i;
+            ++j;
+        }
+        result.count += result.containers.back().cardinality;
+    }
+    return result;
+}
+
+bool BitmapIndex::operator==(const BitmapIndex& other) const {
+    if (count != other.count || containers.size() != other.containers.size()) {
+        return false;
+    }
+    for (size_t c = 0; c < containers.size(); c++) {
+        const Container& a = containers[c];
+        const Container& b = other.containers[c];
+        // Même cardinalité, donc même représentation
+        if (a.key != b.key || a.cardinality != b.cardinality
+            || a.values != b.values || a.words != b.words) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<uint32_t> BitmapIndex::toVector() const {
+    std::vector<uint32_t> result;
+    result.reserve(count);
+    forEach([&result](uint32_t value) {
+        result.push_back(value);
+    });
+    return result;
+}
\ No newline at end of file
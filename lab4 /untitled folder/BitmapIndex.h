@@ -0,0 +1,86 @@
+#pragma once
+#ifndef BITMAPINDEX_H
+#define BITMAPINDEX_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <bit>
+
+// Ensemble d'entiers 32 bits compressé à la manière de Roaring: les valeurs
+// sont groupées par leurs 16 bits de poids fort. Un groupe peu rempli est un
+// tableau trié de 16 bits, un groupe dense une carte de 65536 bits.
+// Comptes et intersections avancent par groupe, en popcount sur les cartes.
+class BitmapIndex {
+public:
+    static const size_t ARRAY_LIMIT = 4096;   // au-delà: carte de bits
+    static const size_t WORD_COUNT = 1024;    // 65536 bits
+
+private:
+    struct Container {
+        uint16_t key;
+        uint32_t cardinality;
+        std::vector<uint16_t> values;   // tableau trié (words vide)
+        std::vector<uint64_t> words;    // carte de bits (values vide)
+
+        bool isBitmap() const { return !words.empty(); }
+        bool contains(uint16_t low) const;
+        void toBitmap();
+        void toArray();
+    };
+
+    std::vector<Container> containers;   // triés par key
+    uint64_t count;
+
+    Container* findContainer(uint16_t key);
+    const Container* findContainer(uint16_t key) const;
+
+    static uint64_t intersectionCount(const Container& a, const Container& b);
+    static Container intersect(const Container& a, const Container& b);
+    static Container unite(const Container& a, const Container& b);
+
+public:
+    BitmapIndex();
+
+    // false si la valeur était déjà présente (add) ou absente (remove)
+    bool add(uint32_t value);
+    bool remove(uint32_t value);
+    bool contains(uint32_t value) const;
+    void clear();
+
+    uint64_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Nombre de valeurs communes, sans construire l'intersection
+    static uint64_t intersectionCount(const BitmapIndex& a, const BitmapIndex& b);
+
+    BitmapIndex operator&(const BitmapIndex& other) const;
+    BitmapIndex operator|(const BitmapIndex& other) const;
+    bool operator==(const BitmapIndex& other) const;
+
+    // Parcours par valeurs croissantes
+    template <class Function>
+    void forEach(Function function) const {
+        for (const Container& container : containers) {
+            uint32_t high = (uint32_t)container.key << 16;
+            if (!container.isBitmap()) {
+                for (uint16_t low : container.values) {
+                    function(high | low);
+                }
+                continue;
+            }
+            for (size_t w = 0; w < WORD_COUNT; w++) {
+                uint64_t word = container.words[w];
+                while (word != 0) {
+                    uint32_t bit = (uint32_t)std::countr_zero(word);
+                    function(high | (uint32_t)(w * 64 + bit));
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+
+    std::vector<uint32_t> toVector() const;
+};
+
+#endif // BITMAPINDEX_H
\ No newline at end of file
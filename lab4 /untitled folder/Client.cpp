@@ -1,16 +1,17 @@
 #include "Client.h"
+#include "IdService.h"
 #include <iostream>
 #include <sstream>
 #include <string>
 
 using namespace std;
 
-// Initialisation du compteur statique
-int Client::clientCounter = 0;
+// Initialisation du compteur statique (clients existants)
+std::atomic<int> Client::clientCounter(0);
 
 // Constructeurs
 Client::Client() : id(generateClientId()), firstName(""), lastName(""),
-type(ClientType::REGULAR) {
+type(ClientType::REGULAR), observer(nullptr) {
     registrationDate = Date::getCurrentDate();
     clientCounter++;
 }
@@ -18,11 +19,20 @@ type(ClientType::REGULAR) {
 Client::Client(const std::string& firstName, const std::string& lastName,
     const Address& address, ClientType type)
     : id(generateClientId()), firstName(firstName), lastName(lastName),
-    address(address), type(type) {
+    address(address), type(type), observer(nullptr) {
     registrationDate = Date::getCurrentDate();
     clientCounter++;
 }
 
+Client::Client(int id, const std::string& firstName, const std::string& lastName,
+    const Address& address, ClientType type)
+    : id(id), firstName(firstName), lastName(lastName),
+    address(address), type(type), observer(nullptr) {
+    registrationDate = Date::getCurrentDate();
+    clientCounter++;
+    IdService::advancePast(IdKind::CLIENT, id);
+}
+
 // Destructeur virtuel
 Client::~Client() {
     clientCounter--;
@@ -33,11 +43,11 @@ int Client::getId() const {
     return id;
 }
 
-std::string Client::getFirstName() const {
+const std::string& Client::getFirstName() const {
     return firstName;
 }
 
-std::string Client::getLastName() const {
+const std::string& Client::getLastName() const {
     return lastName;
 }
 
@@ -63,17 +73,29 @@ std::string Client::getTypeString() const {
 
 // Setters
 void Client::setFirstName(const std::string& firstName) {
+    std::string oldFirstName = this->firstName;
     this->firstName = firstName;
+    if (observer) {
+        observer->onClientRenamed(*this, oldFirstName, lastName);
+    }
 }
 
 void Client::setLastName(const std::string& lastName) {
+    std::string oldLastName = this->lastName;
     this->lastName = lastName;
+    if (observer) {
+        observer->onClientRenamed(*this, firstName, oldLastName);
+    }
 }
 
 void Client::setAddress(const Address& address) {
     this->address = address;
 }
 
+void Client::setObserver(ClientObserver* observer) {
+    this->observer = observer;
+}
+
 // Mthodes virtuelles
 void Client::displayInfo() const {
     cout << "=== Informations du client ===" << endl;
@@ -100,7 +122,7 @@ int Client::getTotalClients() {
 }
 
 int Client::generateClientId() {
-    return 1000 + clientCounter;
+    return (int)IdService::next(IdKind::CLIENT);
 }
 
 // Oprateurs
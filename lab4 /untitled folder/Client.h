@@ -7,6 +7,7 @@
 #include <string>
 #include <iostream>
 #include <memory>
+#include <atomic>
 
 // Перечисление для типов клиентов
 enum class ClientType {
@@ -14,6 +15,17 @@ enum class ClientType {
     PREMIUM
 };
 
+class Client;
+
+// Уведомляется после смены имени или фамилии клиента
+// (Bank обновляет по нему свои индексы)
+class ClientObserver {
+public:
+    virtual ~ClientObserver() = default;
+    virtual void onClientRenamed(const Client& client,
+        const std::string& oldFirstName, const std::string& oldLastName) = 0;
+};
+
 class Client {
 protected:
     int id;
@@ -23,22 +35,27 @@ protected:
     Date registrationDate;
     ClientType type;
 
-    // Статический счётчик для генерации ID
-    static int clientCounter;
+    ClientObserver* observer; // Bank или nullptr
+
+    // Число существующих клиентов (ID выдаёт IdService)
+    static std::atomic<int> clientCounter;
 
 public:
     // Конструкторы
     Client();
     Client(const std::string& firstName, const std::string& lastName,
         const Address& address, ClientType type = ClientType::REGULAR);
+    // Восстановление с известным ID (например, из журнала): новые ID будут больше
+    Client(int id, const std::string& firstName, const std::string& lastName,
+        const Address& address, ClientType type);
 
     // Виртуальный деструктор
     virtual ~Client();
 
     // Геттеры
     int getId() const;
-    std::string getFirstName() const;
-    std::string getLastName() const;
+    const std::string& getFirstName() const;
+    const std::string& getLastName() const;
     std::string getFullName() const;
     Address getAddress() const;
     Date getRegistrationDate() const;
@@ -50,6 +67,9 @@ public:
     void setLastName(const std::string& lastName);
     void setAddress(const Address& address);
 
+    // Наблюдатель за сменой имени
+    void setObserver(ClientObserver* observer);
+
     // Виртуальные методы
     virtual void displayInfo() const;
     virtual std::string toString() const;
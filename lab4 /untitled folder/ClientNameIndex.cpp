@@ -0,0 +1,153 @@
+#include "ClientNameIndex.h"
+#include <algorithm>
+
+namespace {
+
+const uint32_t NO_NODE = 0xFFFFFFFFu;
+
+}
+
+// Constructeur
+ClientNameIndex::ClientNameIndex() {
+    clear();
+}
+
+// Normalisation
+std::string ClientNameIndex::normalize(const std::string& name) {
+    std::string result;
+    result.reserve(name.size());
+    bool pendingSpace = false;
+    for (char c : name) {
+        if (c == ' ' || c == '\t') {
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            result += ' ';
+            pendingSpace = false;
+        }
+        // Octets non ASCII (lettres accentuées) laissés tels quels
+        result += (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+    }
+    return result;
+}
+
+std::string ClientNameIndex::fullNameKey(const std::string& firstName, const std::string& lastName) {
+    return normalize(firstName) + '\n' + normalize(lastName);
+}
+
+// Mise à jour
+void ClientNameIndex::add(int clientId, const std::string& firstName, const std::string& lastName) {
+    byFullName[fullNameKey(firstName, lastName)].push_back(clientId);
+
+    uint32_t node = 0;
+    nodes[node].subtreeCount++;
+    for (char c : normalize(lastName)) {
+        node = findOrAddChild(node, c);
+        nodes[node].subtreeCount++;
+    }
+    nodes[node].clientIds.push_back(clientId);
+}
+
+void ClientNameIndex::remove(int clientId, const std::string& firstName, const std::string& lastName) {
+    auto it = byFullName.find(fullNameKey(firstName, lastName));
+    if (it != byFullName.end()) {
+        std::vector<int>& ids = it->second;
+        ids.erase(std::remove(ids.begin(), ids.end(), clientId), ids.end());
+        if (ids.empty()) {
+            byFullName.erase(it);
+        }
+    }
+
+    std::string key = normalize(lastName);
+    uint32_t node = findNode(key);
+    if (node == NO_NODE) {
+        return;
+    }
+    std::vector<int>& ids = nodes[node].clientIds;
+    auto idIt = std::find(ids.begin(), ids.end(), clientId);
+    if (idIt == ids.end()) {
+        return;
+    }
+    ids.erase(idIt);
+
+    // Les nœuds vides restent en place; seuls les compteurs diminuent
+    node = 0;
+    nodes[node].subtreeCount--;
+    for (char c : key) {
+        node = findOrAddChild(node, c);
+        nodes[node].subtreeCount--;
+    }
+}
+
+void ClientNameIndex::clear() {
+    byFullName.clear();
+    nodes.assign(1, Node());
+}
+
+// Recherche
+const std::vector<int>* ClientNameIndex::findByFullName(const std::string& firstName,
+    const std::string& lastName) const {
+    auto it = byFullName.find(fullNameKey(firstName, lastName));
+    if (it != byFullName.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+std::vector<int> ClientNameIndex::findByLastNamePrefix(const std::string& prefix, size_t limit) const {
+    std::vector<int> result;
+    uint32_t node = findNode(normalize(prefix));
+    if (node != NO_NODE) {
+        collect(node, limit, result);
+    }
+    return result;
+}
+
+// Parcours du trie
+uint32_t ClientNameIndex::findNode(const std::string& normalizedPrefix) const {
+    uint32_t node = 0;
+    for (char c : normalizedPrefix) {
+        const auto& children = nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), c,
+            [](const std::pair<char, uint32_t>& child, char value) {
+                return child.first < value;
+            });
+        if (it == children.end() || it->first != c) {
+            return NO_NODE;
+        }
+        node = it->second;
+    }
+    return node;
+}
+
+uint32_t ClientNameIndex::findOrAddChild(uint32_t node, char c) {
+    auto& children = nodes[node].children;
+    auto it = std::lower_bound(children.begin(), children.end(), c,
+        [](const std::pair<char, uint32_t>& child, char value) {
+            return child.first < value;
+        });
+    if (it != children.end() && it->first == c) {
+        return it->second;
+    }
+
+    uint32_t child = (uint32_t)nodes.size();
+    children.insert(it, std::make_pair(c, child));
+    nodes.push_back(Node()); // invalide children: ne plus l'utiliser
+    return child;
+}
+
+void ClientNameIndex::collect(uint32_t node, size_t limit, std::vector<int>& result) const {
+    if (result.size() >= limit || nodes[node].subtreeCount == 0) {
+        return; // sous-arbre vide: inutile de descendre
+    }
+    for (int clientId : nodes[node].clientIds) {
+        if (result.size() >= limit) {
+            return;
+        }
+        result.push_back(clientId);
+    }
+    for (const auto& child : nodes[node].children) {
+        collect(child.second, limit, result);
+    }
+}
\ No newline at end of file
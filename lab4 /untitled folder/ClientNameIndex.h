@@ -0,0 +1,52 @@
+#pragma once
+#ifndef CLIENTNAMEINDEX_H
+#define CLIENTNAMEINDEX_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+// Index des clients par nom: table de hachage sur le nom complet normalisé
+// et arbre préfixe (trie) sur le nom de famille pour la recherche à la saisie.
+// Les noms sont normalisés: minuscules ASCII, espaces superflus retirés.
+class ClientNameIndex {
+private:
+    // Nœud du trie; enfants triés par caractère, stockés dans nodes
+    struct Node {
+        std::vector<std::pair<char, uint32_t>> children;
+        std::vector<int> clientIds;   // clients dont le nom se termine ici
+        uint32_t subtreeCount;        // clients dans tout le sous-arbre
+
+        Node() : subtreeCount(0) {}
+    };
+
+    std::unordered_map<std::string, std::vector<int>> byFullName;
+    std::vector<Node> nodes;          // nodes[0] est la racine
+
+    static std::string fullNameKey(const std::string& firstName, const std::string& lastName);
+    uint32_t findNode(const std::string& normalizedPrefix) const;
+    uint32_t findOrAddChild(uint32_t node, char c);
+    void collect(uint32_t node, size_t limit, std::vector<int>& result) const;
+
+public:
+    ClientNameIndex();
+
+    void add(int clientId, const std::string& firstName, const std::string& lastName);
+    void remove(int clientId, const std::string& firstName, const std::string& lastName);
+    void clear();
+
+    // IDs des clients portant exactement ce nom (après normalisation), ou nullptr
+    const std::vector<int>* findByFullName(const std::string& firstName,
+        const std::string& lastName) const;
+
+    // Au plus limit IDs dont le nom de famille commence par prefix,
+    // dans l'ordre alphabétique des noms
+    std::vector<int> findByLastNamePrefix(const std::string& prefix, size_t limit) const;
+
+    static std::string normalize(const std::string& name);
+};
+
+#endif // CLIENTNAMEINDEX_H
\ No newline at end of file
@@ -8,29 +8,65 @@
 
 using namespace std;
 
-// Constructeurs
-Date::Date() {
+namespace {
+
+// Date locale du jour. localtime n'est pas rentrant et cote cher: une
+// conversion par seconde et par thread au plus.
+void localToday(int& day, int& month, int& year) {
+    thread_local time_t cachedSecond = (time_t)-1;
+    thread_local tm cached;
+
     time_t now = time(0);
-    tm* ltm = localtime(&now);
-    day = ltm->tm_mday;
-    month = 1 + ltm->tm_mon;
-    year = 1900 + ltm->tm_year;
+    if (now != cachedSecond) {
+#ifdef _WIN32
+        localtime_s(&cached, &now);
+#else
+        localtime_r(&now, &cached);
+#endif
+        cachedSecond = now;
+    }
+    day = cached.tm_mday;
+    month = 1 + cached.tm_mon;
+    year = 1900 + cached.tm_year;
+}
+
+// Numro de jour (algorithme  days from civil , calendrier grgorien)
+int32_t daysFromCivil(int day, int month, int year) {
+    int y = month <= 2 ? year - 1 : year;
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yearOfEra = y - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void civilFromDays(int32_t dayNumber, int& day, int& month, int& year) {
+    int z = dayNumber + 719468;
+    int era = (z >= 0 ? z : z - 146096) / 146097;
+    int dayOfEra = z - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int monthIndex = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+int32_t today() {
+    int day, month, year;
+    localToday(day, month, year);
+    return daysFromCivil(day, month, year);
+}
+
+}
+
+// Constructeurs
+Date::Date() : dayNumber(today()) {
 }
 
 Date::Date(int day, int month, int year) {
-    if (isValidDate(day, month, year)) {
-        this->day = day;
-        this->month = month;
-        this->year = year;
-    }
-    else {
-        // Si la date est invalide, on met la date courante
-        time_t now = time(0);
-        tm* ltm = localtime(&now);
-        this->day = ltm->tm_mday;
-        this->month = 1 + ltm->tm_mon;
-        this->year = 1900 + ltm->tm_year;
-    }
+    // Si la date est invalide, on met la date courante
+    dayNumber = isValidDate(day, month, year) ? daysFromCivil(day, month, year) : today();
 }
 
 Date::Date(const std::string& dateString) {
@@ -39,17 +75,11 @@ Date::Date(const std::string& dateString) {
     int d, m, y;
 
     if (ss >> d >> dot >> m >> dot >> y && isValidDate(d, m, y)) {
-        day = d;
-        month = m;
-        year = y;
+        dayNumber = daysFromCivil(d, m, y);
     }
     else {
         // Si la date est invalide, on met la date courante
-        time_t now = time(0);
-        tm* ltm = localtime(&now);
-        day = ltm->tm_mday;
-        month = 1 + ltm->tm_mon;
-        year = 1900 + ltm->tm_year;
+        dayNumber = today();
     }
 }
 
@@ -63,54 +93,56 @@ bool Date::isValidDate(int d, int m, int y) const {
 
 // Getters
 int Date::getDay() const {
+    int day, month, year;
+    civilFromDays(dayNumber, day, month, year);
     return day;
 }
 
 int Date::getMonth() const {
+    int day, month, year;
+    civilFromDays(dayNumber, day, month, year);
     return month;
 }
 
 int Date::getYear() const {
+    int day, month, year;
+    civilFromDays(dayNumber, day, month, year);
     return year;
 }
 
 // Setters avec validation
 bool Date::setDay(int day) {
-    if (isValidDate(day, month, year)) {
-        this->day = day;
-        return true;
-    }
-    return false;
+    return setDate(day, getMonth(), getYear());
 }
 
 bool Date::setMonth(int month) {
-    if (isValidDate(day, month, year)) {
-        this->month = month;
-        return true;
-    }
-    return false;
+    return setDate(getDay(), month, getYear());
 }
 
 bool Date::setYear(int year) {
-    if (isValidDate(day, month, year)) {
-        this->year = year;
-        return true;
-    }
-    return false;
+    return setDate(getDay(), getMonth(), year);
 }
 
 bool Date::setDate(int day, int month, int year) {
     if (isValidDate(day, month, year)) {
-        this->day = day;
-        this->month = month;
-        this->year = year;
+        dayNumber = daysFromCivil(day, month, year);
         return true;
     }
     return false;
 }
 
+Date Date::fromDayNumber(int32_t dayNumber) {
+    // Affect directement: le constructeur remplacerait une date hors de
+    // [1900, 2100] par la date du jour
+    Date date(1, 1, 1970);
+    date.dayNumber = dayNumber;
+    return date;
+}
+
 // Mthodes d'affichage
 std::string Date::toString() const {
+    int day, month, year;
+    civilFromDays(dayNumber, day, month, year);
     stringstream ss;
     ss << setw(2) << setfill('0') << day << "."
         << setw(2) << setfill('0') << month << "."
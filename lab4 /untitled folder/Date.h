@@ -1,6 +1,57 @@
-#pragma once
-#include <string>
-class Date {
-public:
-    Date(int day = 1, int month = 1, int year = 1970) {}
-};
\ No newline at end of file
+#pragma once
+#ifndef DATE_H
+#define DATE_H
+
+#include <cstdint>
+#include <compare>
+#include <string>
+
+// Date stocke sous forme compacte: un seul entier, le numro de jour.
+// Comparer ou ranger des dates ne demande aucune conversion; jour, mois
+// et anne sont recalculs  la demande.
+class Date {
+private:
+    int32_t dayNumber;
+
+public:
+    // Constructeurs (date invalide => date courante)
+    Date();
+    Date(int day, int month, int year);
+    Date(const std::string& dateString); // "JJ.MM.AAAA"
+
+    // Validation
+    bool isValidDate(int d, int m, int y) const;
+
+    // Getters
+    int getDay() const;
+    int getMonth() const;
+    int getYear() const;
+
+    // Setters avec validation
+    bool setDay(int day);
+    bool setMonth(int month);
+    bool setYear(int year);
+    bool setDate(int day, int month, int year);
+
+    // Numro de jour: jours depuis le 01.01.1970 (ngatif avant)
+    int32_t toDayNumber() const { return dayNumber; }
+    // Inverse exact de toDayNumber(), y compris hors de [1900, 2100]
+    static Date fromDayNumber(int32_t dayNumber);
+
+    // Affichage
+    std::string toString() const;
+    void display() const;
+
+    // Mthodes statiques
+    static Date getCurrentDate();
+    static bool isLeapYear(int year);
+    static int getDaysInMonth(int month, int year);
+
+    // Oprateurs (ordre chronologique)
+    bool operator==(const Date& other) const { return dayNumber == other.dayNumber; }
+    std::strong_ordering operator<=>(const Date& other) const {
+        return dayNumber <=> other.dayNumber;
+    }
+};
+
+#endif // DATE_H
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "EventSink.h"
+
+// Destination courante
+std::atomic<EventSink*> EventSink::activeSink(&EventSink::console());
+
+EventSink* EventSink::active() {
+    return activeSink.load(std::memory_order_acquire);
+}
+
+void EventSink::setActive(EventSink* sink) {
+    activeSink.store(sink, std::memory_order_release);
+}
+
+EventSink& EventSink::console() {
+    static StreamEventSink sink(std::cout);
+    return sink;
+}
+
+// StreamEventSink
+StreamEventSink::StreamEventSink(std::ostream& out) : out(out) {
+}
+
+void StreamEventSink::emit(const std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << message << '\n';
+}
+
+void StreamEventSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    out.flush();
+}
+
+// BufferedEventSink
+BufferedEventSink::BufferedEventSink(std::ostream& out, size_t capacity)
+    : out(out), capacity(capacity) {
+    buffer.reserve(capacity);
+}
+
+BufferedEventSink::~BufferedEventSink() {
+    flush();
+}
+
+void BufferedEventSink::emit(const std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex);
+    buffer += message;
+    buffer += '\n';
+    if (buffer.size() >= capacity) {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+}
+
+void BufferedEventSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    buffer.clear();
+}
+
+// AsyncEventSink
+AsyncEventSink::AsyncEventSink(EventSink& target)
+    : target(target), stopping(false), writing(false) {
+    writer = std::thread(&AsyncEventSink::writeLoop, this);
+}
+
+AsyncEventSink::~AsyncEventSink() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWriter.notify_one();
+    writer.join();
+    target.flush();
+}
+
+void AsyncEventSink::emit(const std::string& message) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(message);
+    }
+    wakeWriter.notify_one();
+}
+
+void AsyncEventSink::flush() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        drained.wait(lock, [this] { return queue.empty() && !writing; });
+    }
+    target.flush();
+}
+
+void AsyncEventSink::writeLoop() {
+    std::vector<std::string> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeWriter.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (queue.empty()) {
+            return; // arrêt demandé et tout est écrit
+        }
+
+        batch.swap(queue);
+        writing = true;
+        lock.unlock();
+        for (const std::string& message : batch) {
+            target.emit(message);
+        }
+        batch.clear();
+        lock.lock();
+        writing = false;
+        drained.notify_all();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+#ifndef EVENTSINK_H
+#define EVENTSINK_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+
+// Destination des messages lisibles des opérations bancaires.
+// Les variantes silencieuses (try...) n'y écrivent jamais.
+class EventSink {
+private:
+    static std::atomic<EventSink*> activeSink;
+
+public:
+    virtual ~EventSink() = default;
+
+    virtual void emit(const std::string& message) = 0;
+    virtual void flush() {}
+
+    // Destination courante; nullptr si les messages sont désactivés.
+    // Le message n'est formaté que si active() n'est pas nul.
+    static EventSink* active();
+    static void setActive(EventSink* sink); // l'appelant garde la propriété
+    static EventSink& console();            // destination par défaut
+};
+
+// Une ligne par message sur un flux, sans vidage forcé
+class StreamEventSink : public EventSink {
+private:
+    std::ostream& out;
+    std::mutex mutex;
+
+public:
+    explicit StreamEventSink(std::ostream& out);
+
+    void emit(const std::string& message) override;
+    void flush() override;
+};
+
+// Accumule les messages et les écrit par blocs de capacity octets
+class BufferedEventSink : public EventSink {
+private:
+    std::ostream& out;
+    size_t capacity;
+    std::string buffer;
+    std::mutex mutex;
+
+public:
+    BufferedEventSink(std::ostream& out, size_t capacity = 64 * 1024);
+    ~BufferedEventSink();
+
+    void emit(const std::string& message) override;
+    void flush() override;
+};
+
+// Transmet les messages à target depuis un thread dédié:
+// emit() ne fait qu'ajouter à une file
+class AsyncEventSink : public EventSink {
+private:
+    EventSink& target;
+    std::vector<std::string> queue;
+    bool stopping;
+    bool writing;
+    std::mutex mutex;
+    std::condition_variable wakeWriter;
+    std::condition_variable drained;
+    std::thread writer;
+
+    void writeLoop();
+
+public:
+    explicit AsyncEventSink(EventSink& target);
+    ~AsyncEventSink();
+
+    AsyncEventSink(const AsyncEventSink&) = delete;
+    AsyncEventSink& operator=(const AsyncEventSink&) = delete;
+
+    void emit(const std::string& message) override;
+    void flush() override; // attend que la file soit écrite
+};
+
+#endif // EVENTSINK_H
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "IdService.h"
+#include <atomic>
+#include <charconv>
+#include <cstring>
+
+namespace {
+
+// Séquence partagée: première valeur jamais réservée, et génération
+// incrémentée par advancePast pour invalider les blocs des threads
+struct alignas(64) Sequence {
+    std::atomic<int64_t> next;
+    std::atomic<uint64_t> generation;
+    int64_t blockSize;
+};
+
+Sequence sequences[3] = {
+    { 1000, 0, 64 },
+    { 1000, 0, 64 },
+    { 10000, 0, 1024 },
+};
+
+// Bloc réservé par le thread courant: [next, end)
+struct Block {
+    int64_t next = 0;
+    int64_t end = 0;
+    uint64_t generation = 0;
+};
+
+thread_local Block blocks[3];
+
+const size_t ACCOUNT_DIGITS = 7;
+
+}
+
+int64_t IdService::next(IdKind kind) {
+    Sequence& sequence = sequences[(int)kind];
+    Block& block = blocks[(int)kind];
+
+    uint64_t generation = sequence.generation.load(std::memory_order_acquire);
+    if (block.next == block.end || block.generation != generation) {
+        block.next = sequence.next.fetch_add(sequence.blockSize, std::memory_order_relaxed);
+        block.end = block.next + sequence.blockSize;
+        block.generation = generation;
+    }
+    return block.next++;
+}
+
+void IdService::advancePast(IdKind kind, int64_t id) {
+    Sequence& sequence = sequences[(int)kind];
+    int64_t current = sequence.next.load(std::memory_order_relaxed);
+    while (current <= id) {
+        if (sequence.next.compare_exchange_weak(current, id + 1, std::memory_order_relaxed)) {
+            // Seulement si la séquence a avancé: une reprise appelle advancePast
+            // pour chaque enregistrement, le plus souvent sans effet
+            sequence.generation.fetch_add(1, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+int64_t IdService::peek(IdKind kind) {
+    return sequences[(int)kind].next.load(std::memory_order_relaxed);
+}
+
+std::string IdService::formatAccountNumber(int64_t id) {
+    char digits[20];
+    char* end = std::to_chars(digits, digits + sizeof(digits), id).ptr;
+    size_t length = (size_t)(end - digits);
+    size_t padding = length < ACCOUNT_DIGITS ? ACCOUNT_DIGITS - length : 0;
+
+    char buffer[32] = { 'A', 'C', 'C' };
+    std::memset(buffer + 3, '0', padding);
+    std::memcpy(buffer + 3 + padding, digits, length);
+    return std::string(buffer, 3 + padding + length);
+}
+
+int64_t IdService::parseAccountNumber(const std::string& accountNumber) {
+    if (accountNumber.size() < 3 + ACCOUNT_DIGITS || accountNumber.compare(0, 3, "ACC") != 0) {
+        return -1;
+    }
+    int64_t id = -1;
+    const char* first = accountNumber.data() + 3;
+    const char* last = accountNumber.data() + accountNumber.size();
+    auto result = std::from_chars(first, last, id);
+    if (result.ec != std::errc() || result.ptr != last) {
+        return -1;
+    }
+    return id;
+}
\ No newline at end of file
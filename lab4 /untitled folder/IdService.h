@@ -0,0 +1,38 @@
+#pragma once
+#ifndef IDSERVICE_H
+#define IDSERVICE_H
+
+#include <cstdint>
+#include <string>
+
+enum class IdKind {
+    CLIENT,         // à partir de 1000
+    ACCOUNT,        // à partir de 1000 (ACC0001000)
+    TRANSACTION     // à partir de 10000
+};
+
+// Identifiants croissants, jamais réutilisés, communs à toutes les banques
+// du processus. Chaque thread réserve un bloc d'identifiants par un seul
+// fetch_add, puis les distribue sans synchronisation. Les identifiants d'un
+// thread croissent; ceux de plusieurs threads s'entrelacent par blocs, et un
+// bloc entamé à la fin d'un thread laisse un trou.
+class IdService {
+public:
+    static int64_t next(IdKind kind);
+
+    // Reprise (journal, instantané): aucun identifiant <= id ne sera plus
+    // attribué. Si la séquence avance, les blocs déjà réservés par les
+    // threads sont abandonnés.
+    // Appelé avant les opérations concurrentes.
+    static void advancePast(IdKind kind, int64_t id);
+
+    // Borne: tout identifiant déjà attribué lui est inférieur
+    static int64_t peek(IdKind kind);
+
+    // "ACC" suivi d'au moins 7 chiffres, formaté par std::to_chars
+    static std::string formatAccountNumber(int64_t id);
+    // Inverse de formatAccountNumber; -1 pour un autre format
+    static int64_t parseAccountNumber(const std::string& accountNumber);
+};
+
+#endif // IDSERVICE_H
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <functional>
+
+// Tas binaire indexé par identifiant (handle de compte): la position de
+// chaque identifiant est connue, une clé change en O(log n) sans allocation.
+// Before(a, b): la clé a passe avant b (std::greater: tas max). À clé égale,
+// le plus petit identifiant passe avant.
+template <class Before = std::greater<int64_t>>
+class IndexedHeap {
+public:
+    struct Entry {
+        uint32_t id;
+        int64_t key;
+    };
+
+private:
+    static constexpr uint32_t ABSENT = 0xFFFFFFFFu;
+
+    std::vector<uint32_t> heap;        // identifiants
+    std::vector<uint32_t> positions;   // identifiant -> position, ou ABSENT
+    std::vector<int64_t> keys;         // identifiant -> clé
+    Before before;
+
+    bool precedes(uint32_t a, uint32_t b) const {
+        if (keys[a] != keys[b]) {
+            return before(keys[a], keys[b]);
+        }
+        return a < b;
+    }
+
+    void place(size_t position, uint32_t id) {
+        heap[position] = id;
+        positions[id] = (uint32_t)position;
+    }
+
+    void siftUp(size_t position) {
+        uint32_t id = heap[position];
+        while (position > 0) {
+            size_t parent = (position - 1) / 2;
+            if (!precedes(id, heap[parent])) {
+                break;
+            }
+            place(position, heap[parent]);
+            position = parent;
+        }
+        place(position, id);
+    }
+
+    void siftDown(size_t position) {
+        uint32_t id = heap[position];
+        for (;;) {
+            size_t child = 2 * position + 1;
+            if (child >= heap.size()) {
+                break;
+            }
+            if (child + 1 < heap.size() && precedes(heap[child + 1], heap[child])) {
+                child++;
+            }
+            if (!precedes(heap[child], id)) {
+                break;
+            }
+            place(position, heap[child]);
+            position = child;
+        }
+        place(position, id);
+    }
+
+public:
+    size_t size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+
+    bool contains(uint32_t id) const {
+        return id < positions.size() && positions[id] != ABSENT;
+    }
+
+    int64_t keyOf(uint32_t id) const { return keys[id]; }
+
+    // Premier du tas; le tas ne doit pas être vide
+    Entry front() const {
+        return { heap[0], keys[heap[0]] };
+    }
+
+    // Ajoute l'identifiant ou change sa clé
+    void set(uint32_t id, int64_t key) {
+        if (id >= positions.size()) {
+            positions.resize((size_t)id + 1, ABSENT);
+            keys.resize((size_t)id + 1, 0);
+        }
+        if (positions[id] == ABSENT) {
+            keys[id] = key;
+            heap.push_back(id);
+            positions[id] = (uint32_t)(heap.size() - 1);
+            siftUp(heap.size() - 1);
+            return;
+        }
+        int64_t old = keys[id];
+        keys[id] = key;
+        if (before(key, old)) {
+            siftUp(positions[id]);
+        }
+        else {
+            siftDown(positions[id]);
+        }
+    }
+
+    void remove(uint32_t id) {
+        if (!contains(id)) {
+            return;
+        }
+        size_t position = positions[id];
+        positions[id] = ABSENT;
+        uint32_t last = heap.back();
+        heap.pop_back();
+        if (position < heap.size()) {
+            place(position, last);
+            siftUp(position);
+            siftDown(positions[last]);
+        }
+    }
+
+    void clear() {
+        heap.clear();
+        positions.clear();
+        keys.clear();
+    }
+
+    // Les n premiers dans l'ordre, en O(n log n): parcours du tas par le
+    // meilleur d'abord, frontière de candidats dans une petite file
+    std::vector<Entry> best(size_t n) const {
+        std::vector<Entry> result;
+        n = std::min(n, heap.size());
+        if (n == 0) {
+            return result;
+        }
+        result.reserve(n);
+
+        auto later = [this](size_t a, size_t b) {
+            return precedes(heap[b], heap[a]);
+        };
+        std::vector<size_t> storage;
+        storage.reserve(2 * n + 1);
+        std::priority_queue<size_t, std::vector<size_t>, decltype(later)> frontier(later, std::move(storage));
+        frontier.push(0);
+        while (result.size() < n) {
+            size_t position = frontier.top();
+            frontier.pop();
+            result.push_back({ heap[position], keys[heap[position]] });
+            for (size_t child = 2 * position + 1; child <= 2 * position + 2; child++) {
+                if (child < heap.size()) {
+                    frontier.push(child);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Tout le tas, trié du premier au dernier avec after (petits tas seulement)
+    template <class After>
+    std::vector<Entry> sorted(size_t n, After after) const {
+        std::vector<Entry> result;
+        result.reserve(heap.size());
+        for (uint32_t id : heap) {
+            result.push_back({ id, keys[id] });
+        }
+        n = std::min(n, result.size());
+        std::partial_sort(result.begin(), result.begin() + n, result.end(),
+            [&after](const Entry& a, const Entry& b) {
+                if (a.key != b.key) {
+                    return after(a.key, b.key);
+                }
+                return a.id < b.id;
+            });
+        result.resize(n);
+        return result;
+    }
+};
+
+#endif // INDEXEDHEAP_H
\ No newline at end of file
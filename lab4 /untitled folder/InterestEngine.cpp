@@ -0,0 +1,97 @@
+#include "InterestEngine.h"
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace {
+
+// Bloc traité palier par palier; tient dans le cache L1
+const size_t BLOCK_SIZE = 1024;
+
+// En dessous, un seul thread: le lancement coûterait plus que le calcul
+const size_t MIN_ROWS_PER_THREAD = 65536;
+
+}
+
+// Constructeur
+InterestEngine::InterestEngine(const InterestSchedule& schedule)
+    : fee(schedule.fee.getCents()), feeWaiver(schedule.feeWaiverBalance.getCents()) {
+    for (size_t t = 0; t < schedule.tiers.size(); t++) {
+        double floor = (double)schedule.tiers[t].floor.getCents();
+        double width = std::numeric_limits<double>::infinity();
+        if (t + 1 < schedule.tiers.size()) {
+            width = (double)schedule.tiers[t + 1].floor.getCents() - floor;
+        }
+        floors.push_back(floor);
+        widths.push_back(width);
+        rates.push_back(schedule.tiers[t].annualRate * schedule.periodDays / 365.0);
+    }
+}
+
+// Calcul
+void InterestEngine::compute(const int64_t* balances, int64_t* interest, int64_t* fees,
+    size_t count) const {
+    double accrued[BLOCK_SIZE];
+    double amounts[BLOCK_SIZE];
+
+    for (size_t first = 0; first < count; first += BLOCK_SIZE) {
+        size_t rows = std::min(BLOCK_SIZE, count - first);
+        const int64_t* block = balances + first;
+
+        for (size_t i = 0; i < rows; i++) {
+            amounts[i] = (double)block[i];
+            accrued[i] = 0.0;
+        }
+
+        // Part du solde dans chaque palier, bornée à [0, largeur]
+        for (size_t t = 0; t < rates.size(); t++) {
+            const double floor = floors[t];
+            const double width = widths[t];
+            const double rate = rates[t];
+            for (size_t i = 0; i < rows; i++) {
+                double part = std::min(std::max(amounts[i] - floor, 0.0), width);
+                accrued[i] += part * rate;
+            }
+        }
+
+        for (size_t i = 0; i < rows; i++) {
+            int64_t earned = (int64_t)accrued[i];
+            int64_t available = block[i] + earned;
+            int64_t charged = block[i] < feeWaiver ? fee : 0;
+            interest[first + i] = earned;
+            fees[first + i] = charged < available ? charged : (available > 0 ? available : 0);
+        }
+    }
+}
+
+void InterestEngine::computeParallel(const int64_t* balances, int64_t* interest, int64_t* fees,
+    size_t count, unsigned threads) const {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = (unsigned)std::min<size_t>(threads, std::max<size_t>(1, count / MIN_ROWS_PER_THREAD));
+    if (threads <= 1) {
+        compute(balances, interest, fees, count);
+        return;
+    }
+
+    // Tranches contiguës, multiples d'un bloc: count / threads arrondi vers
+    // le haut, puis au bloc, pour que les tranches couvrent toutes les lignes
+    size_t perThread = (count + threads - 1) / threads;
+    perThread = (perThread + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        size_t first = t * perThread;
+        if (first >= count) {
+            break;
+        }
+        size_t rows = std::min(perThread, count - first);
+        workers.emplace_back([this, balances, interest, fees, first, rows]() {
+            compute(balances + first, interest + first, fees + first, rows);
+        });
+    }
+    compute(balances, interest, fees, std::min(perThread, count));
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
\ No newline at end of file
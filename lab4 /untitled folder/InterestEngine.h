@@ -0,0 +1,55 @@
+#pragma once
+#ifndef INTERESTENGINE_H
+#define INTERESTENGINE_H
+
+#include "Money.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Palier: taux annuel appliqué à la part du solde au-dessus de floor
+struct InterestTier {
+    Money floor;
+    double annualRate;      // 0.02 pour 2 %
+};
+
+// Barème des comptes épargne pour une période
+struct InterestSchedule {
+    std::vector<InterestTier> tiers;    // floor croissants, le premier à 0
+    int periodDays;                     // 1 pour le traitement de nuit
+    Money fee;                          // frais de tenue de compte par période
+    Money feeWaiverBalance;             // pas de frais à partir de ce solde
+
+    InterestSchedule() : periodDays(1) {}
+};
+
+struct InterestSummary {
+    size_t accounts;        // comptes traités
+    Money totalInterest;
+    Money totalFees;
+};
+
+// Calcul des intérêts et frais sur une colonne dense de soldes (centimes).
+// Boucles sans branche, palier par palier sur des blocs courts: le
+// compilateur les vectorise. Les blocs sont répartis entre plusieurs threads.
+class InterestEngine {
+private:
+    std::vector<double> floors;     // centimes
+    std::vector<double> widths;     // largeur du palier, infinie pour le dernier
+    std::vector<double> rates;      // taux de la période
+    int64_t fee;
+    int64_t feeWaiver;
+
+public:
+    explicit InterestEngine(const InterestSchedule& schedule);
+
+    // interest[i] et fees[i] pour balances[i]; intérêts arrondis au centime
+    // inférieur, frais plafonnés au solde augmenté des intérêts
+    void compute(const int64_t* balances, int64_t* interest, int64_t* fees,
+        size_t count) const;
+    // Idem sur threads threads (0: un par cœur)
+    void computeParallel(const int64_t* balances, int64_t* interest, int64_t* fees,
+        size_t count, unsigned threads = 0) const;
+};
+
+#endif // INTERESTENGINE_H
\ No newline at end of file
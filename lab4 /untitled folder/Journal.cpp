@@ -0,0 +1,257 @@
+#include "Journal.h"
+#include "MappedFile.h"
+#include "EventSink.h"
+#include <cstring>
+#include <chrono>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char JOURNAL_MAGIC[8] = { 'B', 'N', 'K', 'J', 'R', 'N', 'L', '1' };
+
+struct JournalHeader {
+    char magic[8];
+    uint32_t recordSize;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(JournalHeader) == 16, "JournalHeader doit faire 16 octets");
+
+bool syncToDisk(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+}
+
+// JournalRecord
+JournalRecord::JournalRecord() {
+    std::memset(this, 0, sizeof(JournalRecord));
+}
+
+std::string JournalRecord::readField(const char* field, size_t size) {
+    return std::string(field, strnlen(field, size));
+}
+
+void JournalRecord::writeField(char* field, size_t size, const std::string& value) {
+    // Tronqué si trop long; le reste du champ est mis à zéro
+    std::memset(field, 0, size);
+    std::memcpy(field, value.data(), value.size() < size ? value.size() : size);
+}
+
+// Constructeurs
+Journal::Journal() : file(nullptr), commitIntervalMs(5), stopping(false), failed(false) {
+}
+
+Journal::~Journal() {
+    close();
+}
+
+bool Journal::open(const std::string& filename, int commitIntervalMs) {
+    close();
+
+    namespace fs = std::filesystem;
+    std::error_code error;
+
+    if (fs::exists(filename, error) && fs::file_size(filename, error) > 0) {
+        // Ne garder que les enregistrements complets et valides
+        long long valid = read(filename, [](const JournalRecord&) {});
+        if (valid < 0) {
+            return false;
+        }
+        fs::resize_file(filename, sizeof(JournalHeader) + valid * sizeof(JournalRecord), error);
+        if (error) {
+            return false;
+        }
+        file = std::fopen(filename.c_str(), "ab");
+    }
+    else {
+        file = std::fopen(filename.c_str(), "wb");
+        if (file) {
+            JournalHeader header;
+            std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+            header.recordSize = sizeof(JournalRecord);
+            header.reserved = 0;
+            if (std::fwrite(&header, sizeof(header), 1, file) != 1 || !syncToDisk(file)) {
+                std::fclose(file);
+                file = nullptr;
+            }
+        }
+    }
+
+    if (!file) {
+        return false;
+    }
+
+    this->filename = filename;
+    this->commitIntervalMs = commitIntervalMs;
+    stopping = false;
+    failed = false;
+    flusher = std::thread(&Journal::flushLoop, this);
+    return true;
+}
+
+void Journal::close() {
+    if (!file) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeFlusher.notify_one();
+    flusher.join();
+
+    flush();
+    std::fclose(file);
+    file = nullptr;
+}
+
+bool Journal::isOpen() const {
+    return file != nullptr;
+}
+
+bool Journal::hasFailed() const {
+    return failed.load(std::memory_order_acquire);
+}
+
+// Écriture
+void Journal::append(const JournalRecord& record) {
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(record);
+        pending.back().checksum = computeChecksum(pending.back());
+        full = pending.size() >= GROUP_SIZE;
+    }
+    if (full) {
+        wakeFlusher.notify_one();
+    }
+}
+
+void Journal::append(const std::vector<JournalRecord>& records) {
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const JournalRecord& record : records) {
+            pending.push_back(record);
+            pending.back().checksum = computeChecksum(pending.back());
+        }
+        full = pending.size() >= GROUP_SIZE;
+    }
+    if (full) {
+        wakeFlusher.notify_one();
+    }
+}
+
+bool Journal::flush() {
+    std::vector<JournalRecord> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        batch.swap(pending);
+    }
+    return writeBatch(batch);
+}
+
+bool Journal::writeBatch(std::vector<JournalRecord>& batch) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (failed.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    bool written = batch.empty()
+        || std::fwrite(batch.data(), sizeof(JournalRecord), batch.size(), file) == batch.size();
+    if (written && syncToDisk(file)) {
+        return true;
+    }
+
+    // Disque plein ou erreur d'E/S: signalé une seule fois
+    failed.store(true, std::memory_order_release);
+    if (EventSink* sink = EventSink::active()) {
+        sink->emit("Erreur: écriture du journal " + filename + " impossible (lot de "
+            + std::to_string(batch.size()) + " enregistrements); journal arrêté");
+    }
+    return false;
+}
+
+void Journal::flushLoop() {
+    std::vector<JournalRecord> batch;
+    batch.reserve(GROUP_SIZE);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        wakeFlusher.wait_for(lock, std::chrono::milliseconds(commitIntervalMs),
+            [this] { return stopping || pending.size() >= GROUP_SIZE; });
+
+        if (pending.empty()) {
+            continue;
+        }
+
+        // Un seul write + fsync pour tout le groupe
+        batch.swap(pending);
+        lock.unlock();
+        writeBatch(batch);
+        batch.clear();
+        lock.lock();
+    }
+}
+
+// Lecture
+long long Journal::read(const std::string& filename,
+    const std::function<void(const JournalRecord&)>& visit) {
+    MappedFile mapped;
+    if (!mapped.open(filename)) {
+        return -1;
+    }
+
+    const char* data = mapped.getData();
+    size_t size = mapped.getSize();
+
+    JournalHeader header;
+    if (size < sizeof(header)) {
+        return -1;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 ||
+        header.recordSize != sizeof(JournalRecord)) {
+        return -1;
+    }
+
+    size_t count = (size - sizeof(header)) / sizeof(JournalRecord);
+    const char* cursor = data + sizeof(header);
+    long long valid = 0;
+
+    JournalRecord record;
+    for (size_t i = 0; i < count; i++, cursor += sizeof(JournalRecord)) {
+        std::memcpy(&record, cursor, sizeof(JournalRecord));
+        // Une fin de fichier abîmée (écriture interrompue) arrête la lecture
+        if (record.checksum != computeChecksum(record)) {
+            break;
+        }
+        visit(record);
+        valid++;
+    }
+    return valid;
+}
+
+uint32_t Journal::computeChecksum(const JournalRecord& record) {
+    const unsigned char* bytes = (const unsigned char*)&record;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(JournalRecord, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
\ No newline at end of file
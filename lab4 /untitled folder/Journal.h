@@ -0,0 +1,106 @@
+#pragma once
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+// Types d'enregistrements du journal (valeurs stockées sur disque)
+enum class JournalRecordType : uint8_t {
+    NONE = 0,
+    ADD_CLIENT = 1,
+    REMOVE_CLIENT = 2,
+    OPEN_ACCOUNT = 3,
+    CLOSE_ACCOUNT = 4,
+    DEPOSIT = 5,
+    WITHDRAWAL = 6,
+    TRANSFER = 7,
+    INTEREST = 8,
+    FEE = 9,
+    FREEZE = 10,        // changements de statut sans transaction
+    ACTIVATE = 11
+};
+
+// Enregistrement de taille fixe (128 octets), écrit tel quel sur disque
+struct JournalRecord {
+    uint8_t type;           // JournalRecordType
+    uint8_t accountType;    // AccountType pour OPEN_ACCOUNT
+    uint8_t clientType;     // ClientType pour ADD_CLIENT
+    uint8_t reserved;
+    int32_t clientId;
+    int32_t transactionId;
+    int32_t date;           // AAAAMMJJ
+    int64_t amountCents;
+    char fromAccount[16];
+    char toAccount[16];
+    char firstName[34];
+    char lastName[34];
+    uint32_t checksum;      // FNV-1a des 124 premiers octets
+
+    JournalRecord();
+
+    static std::string readField(const char* field, size_t size);
+    static void writeField(char* field, size_t size, const std::string& value);
+};
+
+static_assert(sizeof(JournalRecord) == 128, "JournalRecord doit faire 128 octets");
+
+// Journal binaire en ajout seul avec fsync groupé: les enregistrements
+// ajoutés pendant un intervalle sont écrits et synchronisés ensemble
+class Journal {
+private:
+    std::FILE* file;
+    std::string filename;
+    int commitIntervalMs;
+
+    std::mutex mutex;               // protège pending et stopping
+    std::mutex writeMutex;          // sérialise write + fsync
+    std::condition_variable wakeFlusher;
+    std::vector<JournalRecord> pending;
+    bool stopping;
+    std::thread flusher;
+
+    // Verrouillé à la première erreur d'écriture ou de fsync: la fin du
+    // fichier n'est plus sûre, les enregistrements suivants sont écartés
+    std::atomic<bool> failed;
+
+    void flushLoop();
+    bool writeBatch(std::vector<JournalRecord>& batch);
+
+public:
+    static const size_t GROUP_SIZE = 4096;
+
+    Journal();
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    // Ouvre en ajout (crée le fichier si besoin, tronque une fin incomplète)
+    bool open(const std::string& filename, int commitIntervalMs = 5);
+    void close();
+    bool isOpen() const;
+
+    void append(const JournalRecord& record);
+    void append(const std::vector<JournalRecord>& records); // un seul verrou
+    // Écrit et synchronise tout ce qui est en attente. false si une écriture
+    // a échoué, maintenant ou avant: des opérations validées sont perdues.
+    bool flush();
+    bool hasFailed() const;
+
+    // Parcourt les enregistrements valides d'un journal projeté en mémoire.
+    // Retourne le nombre d'enregistrements lus, -1 si le fichier est illisible.
+    static long long read(const std::string& filename,
+        const std::function<void(const JournalRecord&)>& visit);
+
+    static uint32_t computeChecksum(const JournalRecord& record);
+};
+
+#endif // JOURNAL_H
\ No newline at end of file
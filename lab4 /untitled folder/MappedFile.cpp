@@ -0,0 +1,138 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Constructeurs
+#ifdef _WIN32
+MappedFile::MappedFile()
+    : data(nullptr), length(0), fileHandle(nullptr), mappingHandle(nullptr) {
+}
+#else
+MappedFile::MappedFile() : data(nullptr), length(0), descriptor(-1) {
+}
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    length = (size_t)size.QuadPart;
+
+    // Un fichier vide ne peut pas être projeté: on le traite comme ouvert et vide
+    if (length == 0) {
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+
+    data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (data) {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle) {
+        CloseHandle((HANDLE)mappingHandle);
+    }
+    if (fileHandle) {
+        CloseHandle((HANDLE)fileHandle);
+    }
+    data = nullptr;
+    length = 0;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+}
+
+bool MappedFile::isOpen() const {
+    return fileHandle != nullptr;
+}
+#else
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(descriptor, &info) != 0) {
+        close();
+        return false;
+    }
+    length = (size_t)info.st_size;
+
+    // Un fichier vide ne peut pas être projeté: on le traite comme ouvert et vide
+    if (length == 0) {
+        return true;
+    }
+
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapped == MAP_FAILED) {
+        close();
+        return false;
+    }
+    madvise(mapped, length, MADV_SEQUENTIAL);
+    data = (const char*)mapped;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data) {
+        munmap((void*)data, length);
+    }
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+    data = nullptr;
+    length = 0;
+    descriptor = -1;
+}
+
+bool MappedFile::isOpen() const {
+    return descriptor >= 0;
+}
+#endif
+
+// Getters
+const char* MappedFile::getData() const {
+    return data;
+}
+
+size_t MappedFile::getSize() const {
+    return length;
+}
\ No newline at end of file
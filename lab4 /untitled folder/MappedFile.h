@@ -0,0 +1,36 @@
+#pragma once
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// Fichier projeté en mémoire en lecture seule (mmap / MapViewOfFile)
+class MappedFile {
+private:
+    const char* data;
+    size_t length;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int descriptor;
+#endif
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& filename);
+    void close();
+
+    // Getters
+    bool isOpen() const;
+    const char* getData() const;
+    size_t getSize() const;
+};
+
+#endif // MAPPEDFILE_H
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "Money.h"
+#include <cmath>
+
+// Constructeurs
+Money::Money(double amount) : cents(std::llround(amount * 100.0)) {
+}
+
+Money Money::fromCents(int64_t cents) {
+    Money result;
+    result.cents = cents;
+    return result;
+}
+
+// Conversions
+double Money::toDouble() const {
+    return cents / 100.0;
+}
+
+std::string Money::toString() const {
+    uint64_t absolute = cents < 0 ? 0 - (uint64_t)cents : (uint64_t)cents;
+    std::string result = std::to_string(absolute / 100);
+    unsigned fraction = (unsigned)(absolute % 100);
+    result += '.';
+    result += (char)('0' + fraction / 10);
+    result += (char)('0' + fraction % 10);
+    return cents < 0 ? "-" + result : result;
+}
+
+// Calculs
+Money Money::applyBasisPoints(int64_t basisPoints) const {
+    // Découpage pour éviter le débordement de cents * basisPoints
+    int64_t whole = (cents / 10000) * basisPoints;
+    int64_t rest = (cents % 10000) * basisPoints;
+    int64_t rounded = rest >= 0 ? (rest + 5000) / 10000 : (rest - 5000) / 10000;
+    return fromCents(whole + rounded);
+}
+
+std::ostream& operator<<(std::ostream& os, Money amount) {
+    return os << amount.toString();
+}
\ No newline at end of file
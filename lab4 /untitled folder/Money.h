@@ -0,0 +1,44 @@
+#pragma once
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <cstdint>
+#include <compare>
+#include <string>
+#include <iostream>
+
+// Montant en centimes (entier 64 bits): les sommes sont exactes et
+// ne dépendent pas de l'ordre d'addition
+class Money {
+private:
+    int64_t cents;
+
+public:
+    // Constructeurs
+    Money() : cents(0) {}
+    explicit Money(double amount); // arrondi au centime le plus proche
+
+    static Money fromCents(int64_t cents);
+
+    // Getters
+    int64_t getCents() const { return cents; }
+    double toDouble() const;
+    std::string toString() const; // "1234.56"
+
+    // Montant * basisPoints / 10000, arrondi au centime le plus proche
+    Money applyBasisPoints(int64_t basisPoints) const;
+
+    // Opérateurs
+    Money operator+(Money other) const { return fromCents(cents + other.cents); }
+    Money operator-(Money other) const { return fromCents(cents - other.cents); }
+    Money operator-() const { return fromCents(-cents); }
+    Money& operator+=(Money other) { cents += other.cents; return *this; }
+    Money& operator-=(Money other) { cents -= other.cents; return *this; }
+
+    auto operator<=>(const Money& other) const = default;
+    bool operator==(const Money& other) const = default;
+};
+
+std::ostream& operator<<(std::ostream& os, Money amount);
+
+#endif // MONEY_H
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Pool d'objets d'un même type, construits dans des blocs de BLOCK_SIZE
+// emplacements pris à une ressource mémoire (pmr): une allocation par bloc.
+// Les adresses ne bougent jamais; les objets ne sont détruits qu'avec le pool.
+template <class T, size_t BLOCK_SIZE = 256>
+class ObjectPool {
+private:
+    std::pmr::memory_resource* resource;
+    std::vector<T*> blocks;
+    size_t count;   // objets construits
+
+public:
+    explicit ObjectPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : resource(resource), count(0) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ~ObjectPool() {
+        clear();
+    }
+
+    template <class... Args>
+    T* create(Args&&... args) {
+        size_t block = count / BLOCK_SIZE;
+        if (block == blocks.size()) {
+            blocks.push_back(static_cast<T*>(resource->allocate(BLOCK_SIZE * sizeof(T), alignof(T))));
+        }
+        // Si le constructeur lève, l'emplacement reste libre pour le suivant
+        T* object = ::new (static_cast<void*>(blocks[block] + count % BLOCK_SIZE))
+            T(std::forward<Args>(args)...);
+        count++;
+        return object;
+    }
+
+    // Détruit tous les objets (ordre inverse) et rend les blocs
+    void clear() {
+        while (count > 0) {
+            count--;
+            blocks[count / BLOCK_SIZE][count % BLOCK_SIZE].~T();
+        }
+        for (T* block : blocks) {
+            resource->deallocate(block, BLOCK_SIZE * sizeof(T), alignof(T));
+        }
+        blocks.clear();
+    }
+
+    size_t size() const { return count; }
+};
+
+#endif // OBJECTPOOL_H
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include "OperationStatus.h"
+
+const char* operationStatusString(OperationStatus status) {
+    switch (status) {
+    case OperationStatus::OK: return "Succès";
+    case OperationStatus::NOT_FOUND: return "Compte non trouvé";
+    case OperationStatus::INVALID_AMOUNT: return "Montant invalide";
+    case OperationStatus::INVALID_OPERATION: return "Opération invalide";
+    case OperationStatus::INACTIVE: return "Compte non actif";
+    case OperationStatus::INSUFFICIENT_FUNDS: return "Fonds insuffisants";
+    case OperationStatus::NON_ZERO_BALANCE: return "Solde non nul";
+    case OperationStatus::REJECTED: return "Lot rejeté";
+    case OperationStatus::LIMIT_EXCEEDED: return "Limite de vélocité atteinte";
+    default: return "Statut inconnu";
+    }
+}
\ No newline at end of file
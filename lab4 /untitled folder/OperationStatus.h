@@ -0,0 +1,23 @@
+#pragma once
+#ifndef OPERATIONSTATUS_H
+#define OPERATIONSTATUS_H
+
+#include <cstdint>
+
+// Résultat d'une opération des API silencieuses (aucune entrée/sortie)
+enum class OperationStatus : uint8_t {
+    OK,
+    NOT_FOUND,           // compte inconnu
+    INVALID_AMOUNT,      // montant nul ou négatif
+    INVALID_OPERATION,   // type non pris en charge, ou transfert vers le même compte
+    INACTIVE,            // compte fermé ou gelé
+    INSUFFICIENT_FUNDS,
+    NON_ZERO_BALANCE,    // fermeture ou réactivation impossible avec un solde
+    REJECTED,            // valide, mais le lot a été refusé à cause d'une autre opération
+    LIMIT_EXCEEDED       // limite de vélocité du compte atteinte
+};
+
+// Libellé court, pour les messages et les journaux
+const char* operationStatusString(OperationStatus status);
+
+#endif // OPERATIONSTATUS_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <cmath>
 
 using namespace std;
 
@@ -20,6 +21,12 @@ PremiumClient::PremiumClient(const std::string& firstName, const std::string& la
     if (discountRate > 50) this->discountRate = 50;
 }
 
+PremiumClient::PremiumClient(int id, const std::string& firstName, const std::string& lastName,
+    const Address& address)
+    : Client(id, firstName, lastName, address, ClientType::PREMIUM),
+    discountRate(10.0), premiumLevel("Gold") {
+}
+
 // Getters
 double PremiumClient::getDiscountRate() const {
     return discountRate;
@@ -45,8 +52,10 @@ void PremiumClient::setPremiumLevel(const std::string& level) {
 }
 
 // Mthodes spcifiques aux clients premium
-double PremiumClient::calculateDiscountedAmount(double amount) const {
-    return amount * (1 - discountRate / 100.0);
+Money PremiumClient::calculateDiscountedAmount(Money amount) const {
+    // Taux en points de base pour rester en arithmtique entire
+    int64_t keptBasisPoints = 10000 - std::llround(discountRate * 100.0);
+    return amount.applyBasisPoints(keptBasisPoints);
 }
 
 void PremiumClient::displayBenefits() const {
@@ -3,6 +3,7 @@
 #define PREMIUMCLIENT_H
 
 #include "Client.h"
+#include "Money.h"
 #include <string>
 
 class PremiumClient : public Client {
@@ -16,6 +17,9 @@ public:
     PremiumClient(const std::string& firstName, const std::string& lastName,
         const Address& address, double discountRate = 10.0,
         const std::string& premiumLevel = "Gold");
+    // Восстановление с известным ID (например, из журнала)
+    PremiumClient(int id, const std::string& firstName, const std::string& lastName,
+        const Address& address);
 
     // Геттеры
     double getDiscountRate() const;
@@ -27,7 +31,7 @@ public:
     void setPremiumLevel(const std::string& level);
 
     // Методы премиум-клиента
-    double calculateDiscountedAmount(double amount) const;
+    Money calculateDiscountedAmount(Money amount) const;
     void displayBenefits() const;
 
     // Переопределённые виртуальные методы
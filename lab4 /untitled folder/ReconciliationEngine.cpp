@@ -0,0 +1,74 @@
+#include "ReconciliationEngine.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+// En dessous, un seul thread: la plage de soldes tient déjà en cache
+const size_t MIN_ACCOUNTS_PER_THREAD = 16384;
+
+}
+
+// Constructeur
+ReconciliationEngine::ReconciliationEngine() : rowCount(0) {
+}
+
+void ReconciliationEngine::addBlock(const AccountHandle* fromAccounts,
+    const AccountHandle* toAccounts, const int64_t* amounts, size_t rows) {
+    if (rows == 0) {
+        return;
+    }
+    blocks.push_back({ fromAccounts, toAccounts, amounts, rows });
+    rowCount += rows;
+}
+
+// Comptes [first, last): un handle hors plage (dont NO_ACCOUNT) donne, après
+// soustraction non signée, un indice >= width et la ligne est ignorée
+void ReconciliationEngine::replayRange(int64_t* balances, AccountHandle first,
+    AccountHandle last) const {
+    const uint32_t width = last - first;
+    int64_t* slice = balances + first;
+
+    for (const Block& block : blocks) {
+        const AccountHandle* fromAccounts = block.fromAccounts;
+        const AccountHandle* toAccounts = block.toAccounts;
+        const int64_t* amounts = block.amounts;
+        for (size_t i = 0; i < block.rows; i++) {
+            uint32_t from = fromAccounts[i] - first;
+            uint32_t to = toAccounts[i] - first;
+            if (from < width) {
+                slice[from] -= amounts[i];
+            }
+            if (to < width) {
+                slice[to] += amounts[i];
+            }
+        }
+    }
+}
+
+void ReconciliationEngine::replay(int64_t* balances, size_t accountCount, unsigned threads) const {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = (unsigned)std::min<size_t>(threads,
+        std::max<size_t>(1, accountCount / MIN_ACCOUNTS_PER_THREAD));
+    if (threads <= 1) {
+        replayRange(balances, 0, (AccountHandle)accountCount);
+        return;
+    }
+
+    // Plages égales; la dernière prend le reste
+    size_t perThread = accountCount / threads;
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        AccountHandle first = (AccountHandle)(t * perThread);
+        AccountHandle last = (AccountHandle)(t + 1 == threads ? accountCount : (t + 1) * perThread);
+        workers.emplace_back([this, balances, first, last]() {
+            replayRange(balances, first, last);
+        });
+    }
+    replayRange(balances, 0, (AccountHandle)perThread);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+#ifndef RECONCILIATIONENGINE_H
+#define RECONCILIATIONENGINE_H
+
+#include "Money.h"
+#include "AccountRegistry.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Compte dont le solde tenu ne correspond pas à son historique
+struct ReconciliationMismatch {
+    AccountHandle handle;
+    std::string accountNumber;
+    Money recorded;     // BankAccount::getBalance()
+    Money expected;     // solde de départ + crédits - débits
+};
+
+struct ReconciliationReport {
+    size_t accounts;        // comptes vérifiés
+    size_t transactions;    // lignes rejouées
+    std::vector<ReconciliationMismatch> mismatches;
+
+    ReconciliationReport() : accounts(0), transactions(0) {}
+    bool isConsistent() const { return mismatches.empty(); }
+};
+
+// Rejeu de colonnes de transactions: chaque ligne débite son compte source
+// et crédite son compte destination (NO_ACCOUNT est ignoré). Les comptes sont
+// répartis en plages contiguës, une par thread: chaque thread parcourt toutes
+// les lignes mais n'écrit que dans sa plage de soldes, qui reste en cache,
+// sans écriture partagée ni verrou.
+class ReconciliationEngine {
+private:
+    // Bloc de lignes (colonnes d'un bloc de TransactionStore)
+    struct Block {
+        const AccountHandle* fromAccounts;
+        const AccountHandle* toAccounts;
+        const int64_t* amounts;     // centimes
+        size_t rows;
+    };
+    std::vector<Block> blocks;
+    size_t rowCount;
+
+    void replayRange(int64_t* balances, AccountHandle first, AccountHandle last) const;
+
+public:
+    ReconciliationEngine();
+
+    // Les colonnes ne doivent plus changer jusqu'à la fin de replay()
+    void addBlock(const AccountHandle* fromAccounts, const AccountHandle* toAccounts,
+        const int64_t* amounts, size_t rows);
+    size_t size() const { return rowCount; }
+
+    // balances[h] (centimes) reçoit en entrée le solde de départ du compte h,
+    // en sortie le solde attendu. threads = 0: un par cœur.
+    void replay(int64_t* balances, size_t accountCount, unsigned threads = 0) const;
+};
+
+#endif // RECONCILIATIONENGINE_H
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "ReportWriter.h"
+#include "Date.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Deux chiffres, avec zéro en tête
+void writeTwoDigits(char* out, int value) {
+    out[0] = (char)('0' + value / 10);
+    out[1] = (char)('0' + value % 10);
+}
+
+// Emplacement de l'anneau de tranches: ready vaut numéro de tranche + 1 une
+// fois la tranche formatée
+struct SliceSlot {
+    ReportBuffer buffer;
+    std::atomic<size_t> ready{ 0 };
+};
+
+}
+
+// Tampon
+ReportBuffer::ReportBuffer() : cachedDay(INT32_MIN) {
+}
+
+void ReportBuffer::appendInt(int64_t value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    text.append(digits, result.ptr);
+}
+
+void ReportBuffer::appendMoney(int64_t cents) {
+    char digits[32];
+    char* p = digits;
+    uint64_t magnitude = (uint64_t)cents;
+    if (cents < 0) {
+        *p++ = '-';
+        magnitude = 0 - magnitude;
+    }
+    p = std::to_chars(p, digits + sizeof(digits) - 3, magnitude / 100).ptr;
+    *p++ = '.';
+    writeTwoDigits(p, (int)(magnitude % 100));
+    text.append(digits, p + 2);
+}
+
+void ReportBuffer::appendDate(int32_t dayNumber) {
+    if (dayNumber != cachedDay) {
+        Date date = Date::fromDayNumber(dayNumber);
+        int year = date.getYear();
+        cachedDate[0] = (char)('0' + year / 1000 % 10);
+        cachedDate[1] = (char)('0' + year / 100 % 10);
+        writeTwoDigits(cachedDate + 2, year % 100);
+        cachedDate[4] = '-';
+        writeTwoDigits(cachedDate + 5, date.getMonth());
+        cachedDate[7] = '-';
+        writeTwoDigits(cachedDate + 8, date.getDay());
+        cachedDay = dayNumber;
+    }
+    text.append(cachedDate, sizeof(cachedDate));
+}
+
+void ReportBuffer::appendText(std::string_view value, ReportFormat format) {
+    if (format == ReportFormat::CSV) {
+        if (value.find_first_of(",\"\r\n") == std::string_view::npos) {
+            text.append(value);
+            return;
+        }
+        text.push_back('"');
+        for (char c : value) {
+            if (c == '"') {
+                text.push_back('"');
+            }
+            text.push_back(c);
+        }
+        text.push_back('"');
+        return;
+    }
+
+    // JSON: les octets non ASCII (UTF-8) passent tels quels
+    static const char hex[] = "0123456789abcdef";
+    text.push_back('"');
+    for (char c : value) {
+        unsigned char byte = (unsigned char)c;
+        if (c == '"' || c == '\\') {
+            text.push_back('\\');
+            text.push_back(c);
+        }
+        else if (byte < 0x20) {
+            char escaped[6] = { '\\', 'u', '0', '0', hex[byte >> 4], hex[byte & 15] };
+            text.append(escaped, sizeof(escaped));
+        }
+        else {
+            text.push_back(c);
+        }
+    }
+    text.push_back('"');
+}
+
+// Écrivain
+ReportWriter::ReportWriter(std::ostream& out, ReportFormat format, unsigned threads)
+    : out(out), format(format), threads(threads) {
+    if (this->threads == 0) {
+        this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void ReportWriter::flush(const ReportBuffer& buffer) {
+    out.write(buffer.data(), (std::streamsize)buffer.size());
+}
+
+void ReportWriter::write(std::string_view text) {
+    out.write(text.data(), (std::streamsize)text.size());
+}
+
+void ReportWriter::writeRows(size_t rows, const RowFormatter& formatRows) {
+    size_t slices = (rows + ROWS_PER_SLICE - 1) / ROWS_PER_SLICE;
+    unsigned workerCount = (unsigned)std::min<size_t>(threads, slices);
+
+    if (workerCount <= 1) {
+        ReportBuffer buffer;
+        for (size_t first = 0; first < rows; first += ROWS_PER_SLICE) {
+            buffer.clear();
+            formatRows(first, std::min(first + ROWS_PER_SLICE, rows), buffer);
+            flush(buffer);
+        }
+        return;
+    }
+
+    // Tranche k -> emplacement k % ringSize. Un thread ne la formate qu'après
+    // l'écriture de la tranche k - ringSize, qui occupait l'emplacement.
+    size_t ringSize = (size_t)workerCount * SLICES_PER_THREAD;
+    std::unique_ptr<SliceSlot[]> ring(new SliceSlot[ringSize]);
+    std::atomic<size_t> nextSlice(0);
+    std::atomic<size_t> written(0);
+
+    auto work = [&]() {
+        for (;;) {
+            size_t slice = nextSlice.fetch_add(1, std::memory_order_relaxed);
+            if (slice >= slices) {
+                return;
+            }
+            for (size_t done = written.load(std::memory_order_acquire);
+                done + ringSize <= slice;
+                done = written.load(std::memory_order_acquire)) {
+                written.wait(done, std::memory_order_acquire);
+            }
+
+            SliceSlot& slot = ring[slice % ringSize];
+            slot.buffer.clear();
+            size_t first = slice * ROWS_PER_SLICE;
+            formatRows(first, std::min(first + ROWS_PER_SLICE, rows), slot.buffer);
+            slot.ready.store(slice + 1, std::memory_order_release);
+            slot.ready.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < workerCount; t++) {
+        workers.emplace_back(work);
+    }
+
+    // Le thread appelant écrit, dans l'ordre
+    for (size_t slice = 0; slice < slices; slice++) {
+        SliceSlot& slot = ring[slice % ringSize];
+        for (size_t ready = slot.ready.load(std::memory_order_acquire);
+            ready != slice + 1;
+            ready = slot.ready.load(std::memory_order_acquire)) {
+            slot.ready.wait(ready, std::memory_order_acquire);
+        }
+        flush(slot.buffer);
+        written.store(slice + 1, std::memory_order_release);
+        written.notify_all();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
\ No newline at end of file
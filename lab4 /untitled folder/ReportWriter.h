@@ -0,0 +1,78 @@
+#pragma once
+#ifndef REPORTWRITER_H
+#define REPORTWRITER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <functional>
+
+enum class ReportFormat {
+    CSV,
+    JSON
+};
+
+// Texte d'une tranche de rapport. Les nombres sont formatés par std::to_chars,
+// sans flux ni locale: montants avec un point décimal, dates AAAA-MM-JJ.
+class ReportBuffer {
+private:
+    std::string text;
+    int32_t cachedDay;      // dernière date formatée (souvent la même)
+    char cachedDate[10];
+
+public:
+    ReportBuffer();
+
+    void reserve(size_t bytes) { text.reserve(bytes); }
+    void clear() { text.clear(); }
+    size_t size() const { return text.size(); }
+    const char* data() const { return text.data(); }
+
+    void append(char c) { text.push_back(c); }
+    void append(std::string_view value) { text.append(value); }
+    void appendInt(int64_t value);
+    void appendMoney(int64_t cents);        // -1234 -> -12.34
+    void appendDate(int32_t dayNumber);     // Date::toDayNumber()
+    // Champ texte: entre guillemets en CSV si nécessaire, chaîne échappée en JSON
+    void appendText(std::string_view value, ReportFormat format);
+};
+
+// Écriture d'un rapport ligne à ligne: les lignes sont formatées par tranches
+// contiguës sur plusieurs threads, et le thread appelant écrit les tranches
+// dans l'ordre dès qu'elles sont prêtes. Seules quelques tranches par thread
+// sont en mémoire à un instant donné.
+class ReportWriter {
+public:
+    // Formate les lignes [first, last) dans buffer; appelé sur n'importe quel thread
+    using RowFormatter = std::function<void(size_t first, size_t last, ReportBuffer& buffer)>;
+
+    static const size_t ROWS_PER_SLICE = 4096;
+    static const size_t SLICES_PER_THREAD = 4;
+
+private:
+    std::ostream& out;
+    ReportFormat format;
+    unsigned threads;
+
+    void flush(const ReportBuffer& buffer);
+
+public:
+    // threads = 0: un par cœur
+    ReportWriter(std::ostream& out, ReportFormat format, unsigned threads = 0);
+
+    ReportWriter(const ReportWriter&) = delete;
+    ReportWriter& operator=(const ReportWriter&) = delete;
+
+    ReportFormat getFormat() const { return format; }
+    unsigned getThreads() const { return threads; }
+
+    // En-tête, séparateurs ou fin du rapport, écrits tels quels
+    void write(std::string_view text);
+    void writeRows(size_t rows, const RowFormatter& formatRows);
+
+    bool good() const { return out.good(); }
+};
+
+#endif // REPORTWRITER_H
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "ShardMailbox.h"
+
+// Constructeur
+ShardMailbox::ShardMailbox() : head(&stub), tail(&stub), signal(0) {
+}
+
+// Producteurs
+void ShardMailbox::link(ShardMessage* message) {
+    message->next.store(nullptr, std::memory_order_relaxed);
+    ShardMessage* previous = head.exchange(message, std::memory_order_acq_rel);
+    previous->next.store(message, std::memory_order_release);
+}
+
+void ShardMailbox::push(ShardMessage* message) {
+    link(message);
+    wake();
+}
+
+// Consommateur
+ShardMessage* ShardMailbox::pop() {
+    ShardMessage* first = tail;
+    ShardMessage* next = first->next.load(std::memory_order_acquire);
+
+    if (first == &stub) {
+        if (!next) {
+            return nullptr;
+        }
+        tail = next;
+        first = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        tail = next;
+        return first;
+    }
+
+    // Dernier message: un producteur est peut-être en train de le suivre
+    if (first != head.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    // Réinsérer le talon pour pouvoir détacher le dernier message
+    link(&stub);
+    next = first->next.load(std::memory_order_acquire);
+    if (next) {
+        tail = next;
+        return first;
+    }
+    return nullptr;
+}
+
+// Réveil
+uint32_t ShardMailbox::currentSignal() const {
+    return signal.load(std::memory_order_acquire);
+}
+
+void ShardMailbox::waitSignal(uint32_t observed) const {
+    signal.wait(observed, std::memory_order_acquire);
+}
+
+void ShardMailbox::wake() {
+    signal.fetch_add(1, std::memory_order_release);
+    signal.notify_one();
+}
\ No newline at end of file
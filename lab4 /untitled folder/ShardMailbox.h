@@ -0,0 +1,73 @@
+#pragma once
+#ifndef SHARDMAILBOX_H
+#define SHARDMAILBOX_H
+
+#include "Money.h"
+#include "AccountRegistry.h"
+#include "OperationStatus.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+class Bank;
+
+// Adresse d'un compte dans un ensemble de banques: shard + handle local
+struct ShardAccount {
+    uint32_t shard;
+    AccountHandle handle;
+};
+
+enum class ShardMessageType : uint8_t {
+    TASK,       // tâche quelconque sur la banque du shard
+    DEBIT,      // transfert, étape 1: débit du compte source
+    CREDIT,     // transfert, étape 2: crédit du compte destination
+    REFUND      // crédit refusé: recrédit du compte source
+};
+
+// Message entre shards; le même message passe d'une boîte à l'autre
+// pendant un transfert (DEBIT -> CREDIT -> REFUND éventuel)
+struct ShardMessage {
+    std::atomic<ShardMessage*> next;
+    ShardMessageType type;
+    OperationStatus status;         // résultat du débit, puis final
+    ShardAccount from;
+    ShardAccount to;
+    Money amount;
+    std::function<void(Bank&)> task;
+    std::function<void(OperationStatus)> done;  // appelé sur le thread qui termine
+
+    ShardMessage() : next(nullptr), type(ShardMessageType::TASK), status(OperationStatus::OK),
+        from{ 0, NO_ACCOUNT }, to{ 0, NO_ACCOUNT } {}
+};
+
+// File sans verrou à producteurs multiples et consommateur unique
+// (file intrusive de Vyukov): push() est un échange atomique, pop() n'est
+// appelé que par le thread du shard. pop() peut retourner nullptr pendant
+// qu'un producteur termine son push(): le signal le réveille ensuite.
+class ShardMailbox {
+private:
+    alignas(64) std::atomic<ShardMessage*> head;   // côté producteurs
+    alignas(64) ShardMessage* tail;                // côté consommateur
+    ShardMessage stub;
+
+    // Compteur de réveil: incrémenté après chaque push, attendu par le consommateur
+    alignas(64) std::atomic<uint32_t> signal;
+
+    void link(ShardMessage* message);
+
+public:
+    ShardMailbox();
+
+    ShardMailbox(const ShardMailbox&) = delete;
+    ShardMailbox& operator=(const ShardMailbox&) = delete;
+
+    void push(ShardMessage* message);
+    ShardMessage* pop();
+
+    // Consommateur: lire le signal avant pop(), puis attendre qu'il change
+    uint32_t currentSignal() const;
+    void waitSignal(uint32_t observed) const;
+    void wake();
+};
+
+#endif // SHARDMAILBOX_H
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include "ShardedBank.h"
+#include "EventSink.h"
+#include <iomanip>
+#include <sstream>
+
+// Constructeur
+ShardedBank::ShardedBank(size_t shardCount, const std::string& name)
+    : inFlight(0), inTransitCents(0), suspenseCents(0) {
+    if (shardCount == 0) {
+        shardCount = 1;
+    }
+    for (size_t i = 0; i < shardCount; i++) {
+        std::stringstream code;
+        code << std::setw(3) << std::setfill('0') << (i + 1);
+
+        auto shard = std::make_unique<Shard>();
+        shard->bankCode = code.str();
+        shard->bank = std::make_unique<Bank>(name, shard->bankCode);
+        shards.push_back(std::move(shard));
+    }
+    // Threads lancés une fois tous les shards créés: ils se transmettent des messages
+    for (size_t i = 0; i < shards.size(); i++) {
+        shards[i]->worker = std::thread(&ShardedBank::run, this, (uint32_t)i);
+    }
+}
+
+ShardedBank::~ShardedBank() {
+    quiesce();
+    for (auto& shard : shards) {
+        shard->stopping.store(true, std::memory_order_release);
+        shard->mailbox.wake();
+    }
+    for (auto& shard : shards) {
+        shard->worker.join();
+    }
+}
+
+// Routage
+size_t ShardedBank::getShardCount() const {
+    return shards.size();
+}
+
+const std::string& ShardedBank::getBankCode(size_t shard) const {
+    return shards[shard]->bankCode;
+}
+
+size_t ShardedBank::findShard(const std::string& bankCode) const {
+    for (size_t i = 0; i < shards.size(); i++) {
+        if (shards[i]->bankCode == bankCode) {
+            return i;
+        }
+    }
+    return shards.size();
+}
+
+size_t ShardedBank::shardFor(const std::string& key) const {
+    return std::hash<std::string>()(key) % shards.size();
+}
+
+// Soumission
+void ShardedBank::post(size_t shard, std::function<void(Bank&)> task) {
+    ShardMessage* message = new ShardMessage();
+    message->type = ShardMessageType::TASK;
+    message->from.shard = (uint32_t)shard;
+    message->task = std::move(task);
+    submit(message);
+}
+
+void ShardedBank::transfer(ShardAccount from, ShardAccount to, Money amount,
+    std::function<void(OperationStatus)> done) {
+    ShardMessage* message = new ShardMessage();
+    message->type = ShardMessageType::DEBIT;
+    message->from = from;
+    message->to = to;
+    message->amount = amount;
+    message->done = std::move(done);
+    submit(message);
+}
+
+void ShardedBank::submit(ShardMessage* message) {
+    inFlight.fetch_add(1, std::memory_order_relaxed);
+    if (message->from.shard >= shards.size() ||
+        (message->type != ShardMessageType::TASK && message->to.shard >= shards.size())) {
+        finish(message, OperationStatus::NOT_FOUND);
+        return;
+    }
+    shards[message->from.shard]->mailbox.push(message);
+}
+
+void ShardedBank::finish(ShardMessage* message, OperationStatus status) {
+    if (message->done) {
+        message->done(status);
+    }
+    delete message;
+    if (inFlight.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        inFlight.notify_all();
+    }
+}
+
+void ShardedBank::quiesce() {
+    int64_t pending = inFlight.load(std::memory_order_acquire);
+    while (pending != 0) {
+        inFlight.wait(pending, std::memory_order_acquire);
+        pending = inFlight.load(std::memory_order_acquire);
+    }
+}
+
+// Thread d'un shard
+void ShardedBank::run(uint32_t shard) {
+    ShardMailbox& mailbox = shards[shard]->mailbox;
+    while (true) {
+        uint32_t observed = mailbox.currentSignal();
+        ShardMessage* message = mailbox.pop();
+        if (message) {
+            process(shard, message);
+            continue;
+        }
+        if (shards[shard]->stopping.load(std::memory_order_acquire)) {
+            break;
+        }
+        mailbox.waitSignal(observed);
+    }
+}
+
+void ShardedBank::process(uint32_t shard, ShardMessage* message) {
+    Bank& bank = *shards[shard]->bank;
+
+    switch (message->type) {
+    case ShardMessageType::TASK:
+        // Une exception ne doit pas arrêter le thread du shard (ni laisser
+        // inFlight bloquer quiesce()); ce que task a déjà modifié reste
+        try {
+            message->task(bank);
+            finish(message, OperationStatus::OK);
+        }
+        catch (const std::exception& error) {
+            if (EventSink* sink = EventSink::active()) {
+                sink->emit("Erreur: tâche du shard " + shards[shard]->bankCode
+                    + " interrompue: " + error.what());
+            }
+            finish(message, OperationStatus::INVALID_OPERATION);
+        }
+        catch (...) {
+            if (EventSink* sink = EventSink::active()) {
+                sink->emit("Erreur: tâche du shard " + shards[shard]->bankCode
+                    + " interrompue par une exception inconnue");
+            }
+            finish(message, OperationStatus::INVALID_OPERATION);
+        }
+        break;
+
+    case ShardMessageType::DEBIT: {
+        if (message->to.shard == shard) {
+            finish(message, bank.tryTransfer(message->from.handle, message->to.handle,
+                message->amount));
+            break;
+        }
+        OperationStatus status = bank.tryWithdraw(message->from.handle, message->amount);
+        if (status != OperationStatus::OK) {
+            finish(message, status);
+            break;
+        }
+        // Le même message part vers le shard destination
+        inTransitCents.fetch_add(message->amount.getCents(), std::memory_order_relaxed);
+        message->type = ShardMessageType::CREDIT;
+        shards[message->to.shard]->mailbox.push(message);
+        break;
+    }
+
+    case ShardMessageType::CREDIT: {
+        OperationStatus status = bank.tryDeposit(message->to.handle, message->amount);
+        if (status == OperationStatus::OK) {
+            inTransitCents.fetch_sub(message->amount.getCents(), std::memory_order_relaxed);
+            finish(message, OperationStatus::OK);
+            break;
+        }
+        // Destination inconnue ou inactive: retour au compte source
+        message->status = status;
+        message->type = ShardMessageType::REFUND;
+        shards[message->from.shard]->mailbox.push(message);
+        break;
+    }
+
+    case ShardMessageType::REFUND: {
+        if (bank.tryDeposit(message->from.handle, message->amount) != OperationStatus::OK) {
+            // Compte source fermé entre-temps: le montant reste en attente
+            suspenseCents.fetch_add(message->amount.getCents(), std::memory_order_relaxed);
+        }
+        inTransitCents.fetch_sub(message->amount.getCents(), std::memory_order_relaxed);
+        finish(message, message->status);
+        break;
+    }
+    }
+}
+
+// Soldes
+Money ShardedBank::getTotalBalance() {
+    quiesce();
+    Money total;
+    for (size_t i = 0; i < shards.size(); i++) {
+        total += call(i, [](Bank& bank) { return bank.getTotalBankBalance(); });
+    }
+    return total + getInTransit() + getSuspense();
+}
+
+Money ShardedBank::getInTransit() const {
+    return Money::fromCents(inTransitCents.load(std::memory_order_relaxed));
+}
+
+Money ShardedBank::getSuspense() const {
+    return Money::fromCents(suspenseCents.load(std::memory_order_relaxed));
+}
\ No newline at end of file
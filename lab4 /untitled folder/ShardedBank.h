@@ -0,0 +1,106 @@
+#pragma once
+#ifndef SHARDEDBANK_H
+#define SHARDEDBANK_H
+
+#include "Bank.h"
+#include "ShardMailbox.h"
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Ensemble de N banques (shards), chacune possédée par son propre thread:
+// une banque n'est touchée que par son thread, sans aucun verrou (mode
+// multi-thread désactivé). Tout passe par la boîte aux lettres du shard.
+// Transfert entre shards en deux étapes: débit sur le shard source (retrait),
+// puis crédit sur le shard destination (dépôt); si le crédit est refusé, le
+// montant revient au compte source. Les shards locaux tiennent lieu des
+// nœuds d'un déploiement réparti: seuls des messages circulent entre eux.
+class ShardedBank {
+private:
+    struct Shard {
+        std::unique_ptr<Bank> bank;
+        std::string bankCode;
+        ShardMailbox mailbox;
+        std::atomic<bool> stopping;
+        std::thread worker;
+
+        Shard() : stopping(false) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<int64_t> inFlight;          // messages soumis, non terminés
+    std::atomic<int64_t> inTransitCents;    // débités, pas encore crédités
+    std::atomic<int64_t> suspenseCents;     // remboursements impossibles (compte d'attente)
+
+    void run(uint32_t shard);
+    void process(uint32_t shard, ShardMessage* message);
+    void submit(ShardMessage* message);
+    void finish(ShardMessage* message, OperationStatus status);
+
+public:
+    // Shards nommés name, codes "001", "002"...
+    explicit ShardedBank(size_t shardCount, const std::string& name = "Banque");
+    ~ShardedBank();
+
+    ShardedBank(const ShardedBank&) = delete;
+    ShardedBank& operator=(const ShardedBank&) = delete;
+
+    // Routage
+    size_t getShardCount() const;
+    const std::string& getBankCode(size_t shard) const;
+    size_t findShard(const std::string& bankCode) const;   // getShardCount() si inconnu
+    size_t shardFor(const std::string& key) const;         // par hachage (nouveaux clients)
+
+    // Exécute task sur le thread du shard. call() attend le résultat; ne pas
+    // l'appeler depuis une tâche du même shard (interblocage). Une exception
+    // de task est relancée par call(); pour post(), elle est signalée à
+    // EventSink et le shard continue.
+    void post(size_t shard, std::function<void(Bank&)> task);
+    template <class F>
+    auto call(size_t shard, F task) -> std::invoke_result_t<F, Bank&>;
+
+    // Transfert asynchrone; done reçoit le statut final sur le thread qui
+    // termine (shard source ou destination), il doit rester bref
+    void transfer(ShardAccount from, ShardAccount to, Money amount,
+        std::function<void(OperationStatus)> done = nullptr);
+
+    // Attend la fin de tout ce qui a été soumis
+    void quiesce();
+
+    // Somme des soldes des shards, montants en transit et en attente compris.
+    // Cohérente si rien n'est soumis pendant l'appel.
+    Money getTotalBalance();
+    Money getInTransit() const;
+    Money getSuspense() const;
+};
+
+template <class F>
+auto ShardedBank::call(size_t shard, F task) -> std::invoke_result_t<F, Bank&> {
+    using Result = std::invoke_result_t<F, Bank&>;
+    auto promise = std::make_shared<std::promise<Result>>();
+    std::future<Result> result = promise->get_future();
+    post(shard, [promise, task = std::move(task)](Bank& bank) mutable {
+        try {
+            if constexpr (std::is_void_v<Result>) {
+                task(bank);
+                promise->set_value();
+            }
+            else {
+                promise->set_value(task(bank));
+            }
+        }
+        catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return result.get();
+}
+
+#endif // SHARDEDBANK_H
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "Snapshot.h"
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = { 'B', 'N', 'K', 'S', 'N', 'A', 'P', '1' };
+
+const uint32_t FNV_OFFSET = 2166136261u;
+
+uint32_t fnv1a(uint32_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool syncToDisk(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+}
+
+SnapshotHeader::SnapshotHeader() {
+    std::memset(this, 0, sizeof(SnapshotHeader));
+    std::memcpy(magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+}
+
+// SnapshotWriter
+SnapshotWriter::SnapshotWriter()
+    : file(nullptr), checksum(FNV_OFFSET), clientCount(0), accountCount(0) {
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    abort();
+}
+
+bool SnapshotWriter::open(const std::string& filename) {
+    abort();
+    this->filename = filename;
+    tempName = filename + ".tmp";
+    checksum = FNV_OFFSET;
+    clientCount = 0;
+    accountCount = 0;
+
+    file = std::fopen(tempName.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    // En-tête provisoire, réécrit par commit()
+    SnapshotHeader header;
+    return std::fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+bool SnapshotWriter::write(const void* data, size_t size) {
+    if (!file) {
+        return false;
+    }
+    checksum = fnv1a(checksum, data, size);
+    return size == 0 || std::fwrite(data, size, 1, file) == 1;
+}
+
+bool SnapshotWriter::writeClients(const SnapshotClientRecord* records, size_t count) {
+    if (accountCount > 0) {
+        return false;
+    }
+    clientCount += (uint32_t)count;
+    return write(records, count * sizeof(SnapshotClientRecord));
+}
+
+bool SnapshotWriter::writeAccounts(const SnapshotAccountRecord* records, size_t count) {
+    accountCount += (uint32_t)count;
+    return write(records, count * sizeof(SnapshotAccountRecord));
+}
+
+bool SnapshotWriter::commit(SnapshotHeader header) {
+    if (!file) {
+        return false;
+    }
+    header.clientCount = clientCount;
+    header.accountCount = accountCount;
+    header.checksum = checksum;
+
+    bool ok = std::fseek(file, 0, SEEK_SET) == 0 &&
+        std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+        syncToDisk(file);
+    ok = std::fclose(file) == 0 && ok;
+    file = nullptr;
+
+    std::error_code error;
+    if (ok) {
+        std::filesystem::rename(tempName, filename, error);
+        ok = !error;
+    }
+    if (!ok) {
+        std::filesystem::remove(tempName, error);
+    }
+    return ok;
+}
+
+void SnapshotWriter::abort() {
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+        std::error_code error;
+        std::filesystem::remove(tempName, error);
+    }
+}
+
+// SnapshotFile
+SnapshotFile::SnapshotFile()
+    : header(nullptr), clientRecords(nullptr), accountRecords(nullptr) {
+}
+
+bool SnapshotFile::open(const std::string& filename) {
+    close();
+    if (!mapped.open(filename)) {
+        return false;
+    }
+
+    const char* data = mapped.getData();
+    size_t size = mapped.getSize();
+    if (size < sizeof(SnapshotHeader)) {
+        close();
+        return false;
+    }
+
+    // La projection est alignée sur une page et les tailles d'enregistrement
+    // sont des multiples de 8: lecture directe, sans copie
+    const SnapshotHeader* candidate = (const SnapshotHeader*)data;
+    size_t clientsSize = (size_t)candidate->clientCount * sizeof(SnapshotClientRecord);
+    size_t accountsSize = (size_t)candidate->accountCount * sizeof(SnapshotAccountRecord);
+    if (std::memcmp(candidate->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+        size != sizeof(SnapshotHeader) + clientsSize + accountsSize ||
+        fnv1a(FNV_OFFSET, data + sizeof(SnapshotHeader), clientsSize + accountsSize) != candidate->checksum) {
+        close();
+        return false;
+    }
+
+    header = candidate;
+    clientRecords = (const SnapshotClientRecord*)(data + sizeof(SnapshotHeader));
+    accountRecords = (const SnapshotAccountRecord*)(data + sizeof(SnapshotHeader) + clientsSize);
+    return true;
+}
+
+void SnapshotFile::close() {
+    mapped.close();
+    header = nullptr;
+    clientRecords = nullptr;
+    accountRecords = nullptr;
+}
+
+const SnapshotHeader& SnapshotFile::getHeader() const {
+    return *header;
+}
+
+std::span<const SnapshotClientRecord> SnapshotFile::getClients() const {
+    if (!header) {
+        return {};
+    }
+    return std::span<const SnapshotClientRecord>(clientRecords, header->clientCount);
+}
+
+std::span<const SnapshotAccountRecord> SnapshotFile::getAccounts() const {
+    if (!header) {
+        return {};
+    }
+    return std::span<const SnapshotAccountRecord>(accountRecords, header->accountCount);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "MappedFile.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <span>
+
+// Instantané binaire de la banque: en-tête, clients puis comptes, en
+// enregistrements de taille fixe lus directement dans le fichier projeté
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t clientCount;
+    uint32_t accountCount;
+    uint64_t epoch;         // numéro de l'instantané dans la banque
+    int32_t day;            // Date::toDayNumber() du gel
+    uint32_t checksum;      // FNV-1a des enregistrements qui suivent
+    char bankName[40];
+    char bankCode[8];
+
+    SnapshotHeader();
+};
+
+struct SnapshotClientRecord {
+    int32_t clientId;
+    uint8_t clientType;     // ClientType
+    uint8_t reserved[3];
+    char firstName[36];
+    char lastName[36];
+};
+
+struct SnapshotAccountRecord {
+    char accountNumber[16];
+    int32_t clientId;
+    uint8_t accountType;    // AccountType
+    uint8_t status;         // AccountStatus
+    uint16_t reserved;
+    int64_t balanceCents;
+};
+
+static_assert(sizeof(SnapshotHeader) == 80, "SnapshotHeader doit faire 80 octets");
+static_assert(sizeof(SnapshotClientRecord) == 80, "SnapshotClientRecord doit faire 80 octets");
+static_assert(sizeof(SnapshotAccountRecord) == 32, "SnapshotAccountRecord doit faire 32 octets");
+
+// Écriture dans un fichier temporaire, renommé par commit() une fois synchronisé:
+// un instantané interrompu ne remplace jamais le précédent
+class SnapshotWriter {
+private:
+    std::FILE* file;
+    std::string filename;
+    std::string tempName;
+    uint32_t checksum;
+    uint32_t clientCount;
+    uint32_t accountCount;
+
+    bool write(const void* data, size_t size);
+
+public:
+    SnapshotWriter();
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    bool open(const std::string& filename);
+    // Tous les clients d'abord, puis les comptes
+    bool writeClients(const SnapshotClientRecord* records, size_t count);
+    bool writeAccounts(const SnapshotAccountRecord* records, size_t count);
+    bool commit(SnapshotHeader header);   // complète les compteurs et la somme
+    void abort();
+};
+
+// Lecture sans copie: les enregistrements restent dans le fichier projeté
+class SnapshotFile {
+private:
+    MappedFile mapped;
+    const SnapshotHeader* header;
+    const SnapshotClientRecord* clientRecords;
+    const SnapshotAccountRecord* accountRecords;
+
+public:
+    SnapshotFile();
+
+    // Vérifie la signature, la taille et la somme de contrôle
+    bool open(const std::string& filename);
+    void close();
+
+    const SnapshotHeader& getHeader() const;
+    std::span<const SnapshotClientRecord> getClients() const;
+    std::span<const SnapshotAccountRecord> getAccounts() const;
+};
+
+#endif // SNAPSHOT_H
\ No newline at end of file
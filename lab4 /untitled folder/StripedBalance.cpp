@@ -0,0 +1,71 @@
+#include "StripedBalance.h"
+#include <thread>
+
+namespace {
+
+// Bande d'un thread: attribuée une fois, en tourniquet
+size_t threadStripeIndex() {
+    static std::atomic<size_t> nextIndex(0);
+    thread_local size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+}
+
+// Constructeur
+StripedBalance::StripedBalance(bool accepting) : accepting(accepting) {
+    unsigned cores = std::thread::hardware_concurrency();
+    stripeCount = cores > 0 ? cores : 1;
+    stripes.reset(new Stripe[stripeCount]);
+    for (size_t i = 0; i < stripeCount; i++) {
+        stripes[i].cents.store(0, std::memory_order_relaxed);
+        stripes[i].inFlight.store(0, std::memory_order_relaxed);
+    }
+}
+
+StripedBalance::Stripe& StripedBalance::localStripe() {
+    return stripes[threadStripeIndex() % stripeCount];
+}
+
+// Dépôt: annoncé sur la bande avant de lire accepting, pour que close()
+// voie soit l'annonce, soit le refus (ordre séquentiel)
+bool StripedBalance::add(int64_t cents) {
+    Stripe& stripe = localStripe();
+    stripe.inFlight.fetch_add(1, std::memory_order_seq_cst);
+    if (!accepting.load(std::memory_order_seq_cst)) {
+        stripe.inFlight.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+    stripe.cents.fetch_add(cents, std::memory_order_relaxed);
+    stripe.inFlight.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void StripedBalance::open() {
+    accepting.store(true, std::memory_order_seq_cst);
+}
+
+void StripedBalance::close() {
+    accepting.store(false, std::memory_order_seq_cst);
+    for (size_t i = 0; i < stripeCount; i++) {
+        while (stripes[i].inFlight.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+int64_t StripedBalance::drain() {
+    int64_t total = 0;
+    for (size_t i = 0; i < stripeCount; i++) {
+        total += stripes[i].cents.exchange(0, std::memory_order_acq_rel);
+    }
+    return total;
+}
+
+int64_t StripedBalance::pending() const {
+    int64_t total = 0;
+    for (size_t i = 0; i < stripeCount; i++) {
+        total += stripes[i].cents.load(std::memory_order_relaxed);
+    }
+    return total;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef STRIPEDBALANCE_H
+#define STRIPEDBALANCE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+
+// Dépôts en attente d'un compte très sollicité, répartis sur des bandes
+// alignées sur une ligne de cache: chaque thread écrit dans la sienne.
+// Les montants ne font que croître jusqu'à drain(), appelé sous le verrou
+// du compte: le solde de base seul ne surestime jamais le solde réel.
+class StripedBalance {
+private:
+    struct alignas(64) Stripe {
+        std::atomic<int64_t> cents;
+        std::atomic<int32_t> inFlight;   // dépôts en cours sur cette bande
+    };
+
+    std::unique_ptr<Stripe[]> stripes;
+    size_t stripeCount;
+    std::atomic<bool> accepting;
+
+    Stripe& localStripe();
+
+public:
+    explicit StripedBalance(bool accepting);
+
+    StripedBalance(const StripedBalance&) = delete;
+    StripedBalance& operator=(const StripedBalance&) = delete;
+
+    // Sans verrou; false si les dépôts sont fermés (compte non actif)
+    bool add(int64_t cents);
+
+    // Appelés sous le verrou du compte
+    void open();
+    void close();            // attend la fin des dépôts en cours
+    int64_t drain();         // retire et retourne le total des bandes
+    int64_t pending() const; // total des bandes, sans les vider
+
+    size_t getStripeCount() const { return stripeCount; }
+};
+
+#endif // STRIPEDBALANCE_H
\ No newline at end of file
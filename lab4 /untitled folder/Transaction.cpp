@@ -1,73 +1,66 @@
 #include "Transaction.h"
+#include "TransactionStore.h"
+#include "IdService.h"
 #include <iostream>
 #include <sstream>
 #include <string>
 
 using namespace std;
 
-// Initialisation du compteur statique
-int Transaction::transactionCounter = 0;
+// Initialisation du compteur statique (transactions enregistres)
+std::atomic<int> Transaction::transactionCounter(0);
 
 // Constructeurs
-Transaction::Transaction()
-    : id(generateTransactionId()), fromAccount(""), toAccount(""),
-    amount(0.0), type(TransactionType::DEPOSIT) {
-    transactionDate = Date::getCurrentDate();
-    transactionCounter++;
+Transaction::Transaction(const TransactionStore* store, size_t row)
+    : store(store), row(row) {
 }
 
-Transaction::Transaction(const std::string& fromAccount, const std::string& toAccount,
-    double amount, TransactionType type)
-    : id(generateTransactionId()), fromAccount(fromAccount), toAccount(toAccount),
-    amount(amount), type(type) {
-    transactionDate = Date::getCurrentDate();
-    transactionCounter++;
+// Getters
+int Transaction::getId() const {
+    return store->getId(row);
 }
 
-Transaction::Transaction(const std::string& accountNumber, double amount, TransactionType type)
-    : id(generateTransactionId()), amount(amount), type(type) {
-    if (type == TransactionType::DEPOSIT || type == TransactionType::OPEN_ACCOUNT) {
-        toAccount = accountNumber;
-    }
-    else if (type == TransactionType::WITHDRAWAL || type == TransactionType::CLOSE_ACCOUNT) {
-        fromAccount = accountNumber;
-    }
-    transactionDate = Date::getCurrentDate();
-    transactionCounter++;
+size_t Transaction::getRow() const {
+    return row;
 }
 
-// Getters
-int Transaction::getId() const {
-    return id;
+const std::string& Transaction::getFromAccount() const {
+    return store->getRegistry()->numberOf(store->getFromAccount(row));
 }
 
-std::string Transaction::getFromAccount() const {
-    return fromAccount;
+const std::string& Transaction::getToAccount() const {
+    return store->getRegistry()->numberOf(store->getToAccount(row));
 }
 
-std::string Transaction::getToAccount() const {
-    return toAccount;
+AccountHandle Transaction::getFromHandle() const {
+    return store->getFromAccount(row);
 }
 
-double Transaction::getAmount() const {
-    return amount;
+AccountHandle Transaction::getToHandle() const {
+    return store->getToAccount(row);
+}
+
+Money Transaction::getAmount() const {
+    return store->getAmount(row);
 }
 
 Date Transaction::getTransactionDate() const {
-    return transactionDate;
+    return Date::fromDayNumber(store->getDate(row));
 }
 
 TransactionType Transaction::getType() const {
-    return type;
+    return store->getType(row);
 }
 
 std::string Transaction::getTypeString() const {
-    switch (type) {
+    switch (getType()) {
     case TransactionType::DEPOSIT: return "Dpt";
     case TransactionType::WITHDRAWAL: return "Retrait";
     case TransactionType::TRANSFER: return "Transfert";
     case TransactionType::OPEN_ACCOUNT: return "Ouverture de compte";
     case TransactionType::CLOSE_ACCOUNT: return "Fermeture de compte";
+    case TransactionType::INTEREST: return "Intrts";
+    case TransactionType::FEE: return "Frais de tenue de compte";
     default: return "Opration inconnue";
     }
 }
@@ -75,42 +68,52 @@ std::string Transaction::getTypeString() const {
 // Mthodes d'affichage
 void Transaction::displayInfo() const {
     cout << "=== Informations de la transaction ===" << endl;
-    cout << "ID: " << id << endl;
+    cout << "ID: " << getId() << endl;
     cout << "Type: " << getTypeString() << endl;
 
-    if (!fromAccount.empty()) {
-        cout << "Compte source: " << fromAccount << endl;
+    if (getFromHandle() != NO_ACCOUNT) {
+        cout << "Compte source: " << getFromAccount() << endl;
     }
 
-    if (!toAccount.empty()) {
-        cout << "Compte destination: " << toAccount << endl;
+    if (getToHandle() != NO_ACCOUNT) {
+        cout << "Compte destination: " << getToAccount() << endl;
     }
 
-    cout << "Montant: " << amount << " " << endl;
+    cout << "Montant: " << getAmount() << " " << endl;
     cout << "Date: ";
-    transactionDate.display();
+    getTransactionDate().display();
     cout << "=======================================" << endl;
 }
 
 std::string Transaction::toString() const {
     stringstream ss;
-    ss << "Transaction #" << id << ": " << getTypeString();
+    ss << "Transaction #" << getId() << ": " << getTypeString();
 
-    if (!fromAccount.empty()) {
-        ss << " du compte " << fromAccount;
+    if (getFromHandle() != NO_ACCOUNT) {
+        ss << " du compte " << getFromAccount();
     }
 
-    if (!toAccount.empty()) {
-        ss << " vers le compte " << toAccount;
+    if (getToHandle() != NO_ACCOUNT) {
+        ss << " vers le compte " << getToAccount();
     }
 
-    ss << " - Montant: " << amount << "  (" << transactionDate.toString() << ")";
+    ss << " - Montant: " << getAmount() << "  (" << getTransactionDate().toString() << ")";
     return ss.str();
 }
 
 // Mthodes statiques
 int Transaction::generateTransactionId() {
-    return 10000 + transactionCounter;
+    return (int)IdService::peek(IdKind::TRANSACTION);
+}
+
+int Transaction::allocateTransactionId() {
+    transactionCounter++;
+    return (int)IdService::next(IdKind::TRANSACTION);
+}
+
+void Transaction::countRestoredTransaction(int id) {
+    transactionCounter++;
+    IdService::advancePast(IdKind::TRANSACTION, id);
 }
 
 int Transaction::getTotalTransactions() {
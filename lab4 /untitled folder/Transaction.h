@@ -3,8 +3,12 @@
 #define TRANSACTION_H
 
 #include "Date.h"
+#include "Money.h"
+#include "AccountRegistry.h"
 #include <string>
 #include <memory>
+#include <cstddef>
+#include <atomic>
 
 // Перечисление для типов транзакций
 enum class TransactionType {
@@ -12,33 +16,35 @@ enum class TransactionType {
     WITHDRAWAL,   // Снятие средств
     TRANSFER,     // Перевод между счетами
     OPEN_ACCOUNT, // Открытие счёта
-    CLOSE_ACCOUNT // Закрытие счёта
+    CLOSE_ACCOUNT, // Закрытие счёта
+    INTEREST,     // Начисление процентов
+    FEE           // Комиссия за обслуживание
 };
 
+class TransactionStore;
+
+// Лёгкое представление одной строки TransactionStore: данные хранятся
+// по столбцам в хранилище, объект копируется дёшево
 class Transaction {
 private:
-    int id;
-    std::string fromAccount;
-    std::string toAccount;
-    double amount;
-    Date transactionDate;
-    TransactionType type;
+    const TransactionStore* store;
+    size_t row;
 
-    // Статический счётчик
-    static int transactionCounter;
+    // Число записанных транзакций (ID выдаёт IdService)
+    static std::atomic<int> transactionCounter;
 
 public:
     // Конструкторы
-    Transaction();
-    Transaction(const std::string& fromAccount, const std::string& toAccount,
-        double amount, TransactionType type);
-    Transaction(const std::string& accountNumber, double amount, TransactionType type);
+    Transaction(const TransactionStore* store, size_t row);
 
     // Геттеры
     int getId() const;
-    std::string getFromAccount() const;
-    std::string getToAccount() const;
-    double getAmount() const;
+    size_t getRow() const;
+    const std::string& getFromAccount() const;
+    const std::string& getToAccount() const;
+    AccountHandle getFromHandle() const;
+    AccountHandle getToHandle() const;
+    Money getAmount() const;
     Date getTransactionDate() const;
     TransactionType getType() const;
     std::string getTypeString() const;
@@ -48,7 +54,9 @@ public:
     std::string toString() const;
 
     // Статические методы
-    static int generateTransactionId();
+    static int generateTransactionId(); // граница: все выданные ID меньше
+    static int allocateTransactionId(); // выдаёт ID и увеличивает счётчик
+    static void countRestoredTransaction(int id); // транзакция из журнала (ID уже есть)
     static int getTotalTransactions();
 };
 
@@ -0,0 +1,70 @@
+#include "TransactionStore.h"
+
+// Constructeur
+TransactionStore::TransactionStore(const AccountRegistry* registry)
+    : count(0), registry(registry) {
+}
+
+// Ajout
+size_t TransactionStore::append(AccountHandle fromAccount, AccountHandle toAccount,
+    Money amount, TransactionType type, int32_t date) {
+    return appendWithId(Transaction::allocateTransactionId(), fromAccount, toAccount,
+        amount, type, date);
+}
+
+size_t TransactionStore::appendWithId(int32_t id, AccountHandle fromAccount,
+    AccountHandle toAccount, Money amount, TransactionType type, int32_t date) {
+    if (count == chunks.size() * CHUNK_SIZE) {
+        // Colonnes non initialisées: seules les lignes < count sont lues
+        chunks.push_back(std::unique_ptr<Chunk>(new Chunk));
+    }
+
+    Chunk& chunk = *chunks.back();
+    size_t slot = count % CHUNK_SIZE;
+    chunk.ids[slot] = id;
+    chunk.types[slot] = (uint8_t)type;
+    chunk.amounts[slot] = amount.getCents();
+    chunk.dates[slot] = date;
+    chunk.fromAccounts[slot] = fromAccount;
+    chunk.toAccounts[slot] = toAccount;
+
+    std::vector<RowRange>& ranges = dayPartitions[date];
+    if (!ranges.empty() && ranges.back().last == count) {
+        ranges.back().last++;
+    }
+    else {
+        ranges.push_back({ count, count + 1 });
+    }
+    return count++;
+}
+
+// Partitions par jour
+std::vector<TransactionStore::RowRange> TransactionStore::rangesBetween(int32_t fromDay,
+    int32_t toDay) const {
+    std::vector<RowRange> result;
+    for (auto it = dayPartitions.lower_bound(fromDay);
+        it != dayPartitions.end() && it->first <= toDay; ++it) {
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    }
+    return result;
+}
+
+// Parcours
+size_t TransactionStore::rowsInChunk(size_t chunk) const {
+    size_t first = chunk * CHUNK_SIZE;
+    return count - first < CHUNK_SIZE ? count - first : CHUNK_SIZE;
+}
+
+Money TransactionStore::totalByType(TransactionType type) const {
+    const uint8_t wanted = (uint8_t)type;
+    int64_t total = 0;
+    for (size_t c = 0; c < chunks.size(); c++) {
+        const Chunk& chunk = *chunks[c];
+        size_t rows = rowsInChunk(c);
+        // Boucle sans branche sur deux colonnes contiguës (vectorisable)
+        for (size_t i = 0; i < rows; i++) {
+            total += chunk.types[i] == wanted ? chunk.amounts[i] : 0;
+        }
+    }
+    return Money::fromCents(total);
+}
\ No newline at end of file
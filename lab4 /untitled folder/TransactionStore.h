@@ -0,0 +1,111 @@
+#pragma once
+#ifndef TRANSACTIONSTORE_H
+#define TRANSACTIONSTORE_H
+
+#include "Transaction.h"
+#include "AccountRegistry.h"
+#include "Money.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <map>
+
+// Journal des transactions en colonnes (struct-of-arrays), alloué par
+// blocs de CHUNK_SIZE lignes. Les lignes ne bougent jamais une fois écrites.
+// Partitionné par jour: une plage de dates ne lit que ses partitions.
+class TransactionStore {
+public:
+    static const size_t CHUNK_SIZE = 65536;
+
+    // Colonnes d'un bloc
+    struct Chunk {
+        int32_t ids[CHUNK_SIZE];
+        uint8_t types[CHUNK_SIZE];
+        int64_t amounts[CHUNK_SIZE];   // centimes
+        int32_t dates[CHUNK_SIZE];     // Date::toDayNumber()
+        AccountHandle fromAccounts[CHUNK_SIZE];
+        AccountHandle toAccounts[CHUNK_SIZE];
+    };
+
+    class iterator {
+    private:
+        const TransactionStore* store;
+        size_t row;
+
+    public:
+        iterator(const TransactionStore* store, size_t row) : store(store), row(row) {}
+
+        Transaction operator*() const { return Transaction(store, row); }
+        iterator& operator++() { ++row; return *this; }
+        bool operator==(const iterator& other) const { return row == other.row; }
+        bool operator!=(const iterator& other) const { return row != other.row; }
+    };
+
+    // Lignes [first, last) d'un même jour
+    struct RowRange {
+        size_t first;
+        size_t last;
+    };
+
+private:
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    size_t count;
+    const AccountRegistry* registry;
+
+    // Jour -> plages de lignes, dans l'ordre d'ajout. Les dates croissent
+    // avec les lignes: en général une seule plage par jour.
+    std::map<int32_t, std::vector<RowRange>> dayPartitions;
+
+    Chunk& chunkFor(size_t row) const { return *chunks[row / CHUNK_SIZE]; }
+
+public:
+    explicit TransactionStore(const AccountRegistry* registry);
+
+    TransactionStore(const TransactionStore&) = delete;
+    TransactionStore& operator=(const TransactionStore&) = delete;
+
+    // Ajout: retourne la ligne. Un ID est attribué sauf s'il est fourni (reprise).
+    // date est un numéro de jour (Date::toDayNumber).
+    size_t append(AccountHandle fromAccount, AccountHandle toAccount,
+        Money amount, TransactionType type, int32_t date);
+    size_t appendWithId(int32_t id, AccountHandle fromAccount, AccountHandle toAccount,
+        Money amount, TransactionType type, int32_t date);
+
+    // Accès par ligne
+    Transaction at(size_t row) const { return Transaction(this, row); }
+    int32_t getId(size_t row) const { return chunkFor(row).ids[row % CHUNK_SIZE]; }
+    TransactionType getType(size_t row) const {
+        return (TransactionType)chunkFor(row).types[row % CHUNK_SIZE];
+    }
+    Money getAmount(size_t row) const {
+        return Money::fromCents(chunkFor(row).amounts[row % CHUNK_SIZE]);
+    }
+    int32_t getDate(size_t row) const { return chunkFor(row).dates[row % CHUNK_SIZE]; }
+    AccountHandle getFromAccount(size_t row) const {
+        return chunkFor(row).fromAccounts[row % CHUNK_SIZE];
+    }
+    AccountHandle getToAccount(size_t row) const {
+        return chunkFor(row).toAccounts[row % CHUNK_SIZE];
+    }
+    const AccountRegistry* getRegistry() const { return registry; }
+
+    // Accès par bloc, pour les parcours de colonnes
+    size_t chunkCount() const { return chunks.size(); }
+    size_t rowsInChunk(size_t chunk) const;
+    const Chunk& getChunk(size_t chunk) const { return *chunks[chunk]; }
+
+    // Plages de lignes datées de fromDay à toDay inclus, par jour puis par ligne
+    std::vector<RowRange> rangesBetween(int32_t fromDay, int32_t toDay) const;
+    size_t partitionCount() const { return dayPartitions.size(); }
+
+    // Somme des montants d'un type de transaction
+    Money totalByType(TransactionType type) const;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, count); }
+};
+
+#endif // TRANSACTIONSTORE_H
\ No newline at end of file
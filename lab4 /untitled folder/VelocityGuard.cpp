@@ -0,0 +1,173 @@
+#include "VelocityGuard.h"
+#include <bit>
+#include <chrono>
+#include <cmath>
+
+VelocityGuard::AccountWindow::AccountWindow()
+    : lastDebitSlot(0), lastPeerSlot(0), debitCounts(), debitCents(), peers() {
+}
+
+// Constructeur
+VelocityGuard::VelocityGuard() : enabled(false), slotSeconds(1), peerLimitBits(PEER_BITS) {
+}
+
+// Configuration
+void VelocityGuard::configure(const VelocityLimits& limits) {
+    this->limits = limits;
+    if (this->limits.maxCounterpartiesPerHour > MAX_COUNTERPARTIES_PER_HOUR) {
+        this->limits.maxCounterpartiesPerHour = MAX_COUNTERPARTIES_PER_HOUR;
+    }
+    bool debitLimits = limits.windowSeconds > 0 &&
+        (limits.maxDebits > 0 || limits.maxDebitTotal > Money());
+    enabled = debitLimits || limits.maxCounterpartiesPerHour > 0;
+
+    // Tranche d'au moins une seconde: une fenêtre plus courte que
+    // DEBIT_SLOTS secondes est arrondie vers le haut
+    slotSeconds = limits.windowSeconds / DEBIT_SLOTS;
+    if (slotSeconds < 1) {
+        slotSeconds = 1;
+    }
+
+    // Comptage linéaire: n destinataires occupent en moyenne
+    // PEER_BITS * (1 - e^(-n/PEER_BITS)) bits; au-delà, n > limite.
+    // Plafonnée, la limite laisse toujours des bits libres au-dessus du seuil.
+    peerLimitBits = PEER_BITS;
+    if (this->limits.maxCounterpartiesPerHour > 0) {
+        double expected = PEER_BITS * (1.0 - std::exp(
+            -this->limits.maxCounterpartiesPerHour / (double)PEER_BITS));
+        peerLimitBits = (int)std::ceil(expected - 1e-9);
+    }
+
+    for (auto& window : windows) {
+        window.reset();
+    }
+}
+
+void VelocityGuard::addAccount(AccountHandle handle) {
+    if (handle >= windows.size()) {
+        windows.resize((size_t)handle + 1);
+    }
+}
+
+// Vérification
+OperationStatus VelocityGuard::check(AccountHandle account, AccountHandle counterparty,
+    Money amount, int64_t now) const {
+    if (!enabled || account >= windows.size() || !windows[account]) {
+        // Aucun débit récent: seul ce débit compterait
+        if (enabled && limits.windowSeconds > 0 &&
+            limits.maxDebitTotal > Money() && amount > limits.maxDebitTotal) {
+            return OperationStatus::LIMIT_EXCEEDED;
+        }
+        return OperationStatus::OK;
+    }
+    const AccountWindow& window = *windows[account];
+
+    if (limits.windowSeconds > 0) {
+        int64_t slot = now / slotSeconds;
+        int64_t count = 0;
+        int64_t cents = 0;
+        // Tranches de la fenêtre déjà écrites; les plus récentes que
+        // lastDebitSlot contiennent encore un tour précédent
+        for (int k = 0; k < DEBIT_SLOTS; k++) {
+            int64_t s = slot - k;
+            if (s <= window.lastDebitSlot && s > window.lastDebitSlot - DEBIT_SLOTS) {
+                count += window.debitCounts[s % DEBIT_SLOTS];
+                cents += window.debitCents[s % DEBIT_SLOTS];
+            }
+        }
+        if (limits.maxDebits > 0 && count + 1 > limits.maxDebits) {
+            return OperationStatus::LIMIT_EXCEEDED;
+        }
+        if (limits.maxDebitTotal > Money() &&
+            cents + amount.getCents() > limits.maxDebitTotal.getCents()) {
+            return OperationStatus::LIMIT_EXCEEDED;
+        }
+    }
+
+    if (limits.maxCounterpartiesPerHour > 0 && counterparty != NO_ACCOUNT) {
+        int64_t slot = now / PEER_SLOT_SECONDS;
+        uint64_t seen[PEER_WORDS] = {};
+        for (int k = 0; k < PEER_SLOTS; k++) {
+            int64_t s = slot - k;
+            if (s <= window.lastPeerSlot && s > window.lastPeerSlot - PEER_SLOTS) {
+                for (int w = 0; w < PEER_WORDS; w++) {
+                    seen[w] |= window.peers[s % PEER_SLOTS][w];
+                }
+            }
+        }
+        unsigned bit = peerBit(counterparty);
+        uint64_t mask = uint64_t(1) << (bit % 64);
+        if ((seen[bit / 64] & mask) == 0) {
+            seen[bit / 64] |= mask;
+            int bits = 0;
+            for (int w = 0; w < PEER_WORDS; w++) {
+                bits += std::popcount(seen[w]);
+            }
+            if (bits > peerLimitBits) {
+                return OperationStatus::LIMIT_EXCEEDED;
+            }
+        }
+    }
+
+    return OperationStatus::OK;
+}
+
+// Enregistrement
+void VelocityGuard::record(AccountHandle account, AccountHandle counterparty,
+    Money amount, int64_t now) {
+    if (!enabled || account >= windows.size()) {
+        return;
+    }
+    std::unique_ptr<AccountWindow>& entry = windows[account];
+    if (!entry) {
+        entry.reset(new AccountWindow());
+        entry->lastDebitSlot = now / slotSeconds;
+        entry->lastPeerSlot = now / PEER_SLOT_SECONDS;
+    }
+    AccountWindow& window = *entry;
+
+    // Remise à zéro des tranches sautées depuis la dernière écriture
+    int64_t slot = now / slotSeconds;
+    for (int64_t s = window.lastDebitSlot + 1; s <= slot && s <= window.lastDebitSlot + DEBIT_SLOTS; s++) {
+        window.debitCounts[s % DEBIT_SLOTS] = 0;
+        window.debitCents[s % DEBIT_SLOTS] = 0;
+    }
+    if (slot > window.lastDebitSlot) {
+        window.lastDebitSlot = slot;
+    }
+    window.debitCounts[slot % DEBIT_SLOTS]++;
+    window.debitCents[slot % DEBIT_SLOTS] += amount.getCents();
+
+    if (counterparty != NO_ACCOUNT) {
+        int64_t peerSlot = now / PEER_SLOT_SECONDS;
+        for (int64_t s = window.lastPeerSlot + 1; s <= peerSlot && s <= window.lastPeerSlot + PEER_SLOTS; s++) {
+            for (int w = 0; w < PEER_WORDS; w++) {
+                window.peers[s % PEER_SLOTS][w] = 0;
+            }
+        }
+        if (peerSlot > window.lastPeerSlot) {
+            window.lastPeerSlot = peerSlot;
+        }
+        unsigned bit = peerBit(counterparty);
+        window.peers[peerSlot % PEER_SLOTS][bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+}
+
+// Outils
+unsigned VelocityGuard::peerBit(AccountHandle counterparty) {
+    // Finaliseur de MurmurHash3: des bits pseudo-aléatoires, comme le suppose
+    // l'estimation (un simple produit répartit les handles consécutifs trop
+    // régulièrement et surestime leur nombre)
+    uint32_t hash = counterparty;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash >> 24;
+}
+
+int64_t VelocityGuard::currentTime() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
\ No newline at end of file
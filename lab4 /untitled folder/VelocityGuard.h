@@ -0,0 +1,86 @@
+#pragma once
+#ifndef VELOCITYGUARD_H
+#define VELOCITYGUARD_H
+
+#include "Money.h"
+#include "AccountRegistry.h"
+#include "OperationStatus.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Limites de vélocité par compte; 0 désactive une limite.
+// Les débits sont les retraits et les transferts sortants.
+struct VelocityLimits {
+    int windowSeconds;              // fenêtre glissante des débits
+    int maxDebits;                  // nombre de débits par fenêtre
+    Money maxDebitTotal;            // montant débité par fenêtre
+    int maxCounterpartiesPerHour;   // destinataires distincts des transferts
+
+    VelocityLimits() : windowSeconds(0), maxDebits(0), maxCounterpartiesPerHour(0) {}
+};
+
+// Compteurs à fenêtre glissante par compte, en tranches circulaires:
+// la fenêtre des débits est découpée en DEBIT_SLOTS tranches, l'heure des
+// destinataires en PEER_SLOTS tranches de 10 minutes. Les tranches périmées
+// sont ignorées à la lecture et remises à zéro à l'écriture suivante.
+// Les destinataires distincts sont estimés par comptage linéaire sur un
+// masque de PEER_BITS bits (exact en l'absence de collision, sinon estimé).
+// Le masque sature vers 256 * ln(256) ~ 1400 destinataires: la limite est
+// ramenée à MAX_COUNTERPARTIES_PER_HOUR, où l'erreur reste de l'ordre de 10 %.
+// check() et record() sont appelés sous le verrou du compte débité.
+class VelocityGuard {
+public:
+    static const int DEBIT_SLOTS = 12;
+    static const int PEER_SLOTS = 6;
+    static const int PEER_SLOT_SECONDS = 600;
+    static const int PEER_WORDS = 4;
+    static const int PEER_BITS = PEER_WORDS * 64;
+    static const int MAX_COUNTERPARTIES_PER_HOUR = 1000;
+
+private:
+    struct AccountWindow {
+        int64_t lastDebitSlot;
+        int64_t lastPeerSlot;
+        uint32_t debitCounts[DEBIT_SLOTS];
+        int64_t debitCents[DEBIT_SLOTS];
+        uint64_t peers[PEER_SLOTS][PEER_WORDS];
+
+        AccountWindow();
+    };
+
+    VelocityLimits limits;
+    bool enabled;
+    int64_t slotSeconds;            // largeur d'une tranche de débits
+    int peerLimitBits;              // bits à 1 au-delà desquels la limite est dépassée
+
+    // Créées au premier débit: les comptes sans débit ne coûtent qu'un pointeur
+    std::vector<std::unique_ptr<AccountWindow>> windows;
+
+    static unsigned peerBit(AccountHandle counterparty);   // indice dans le masque
+
+public:
+    VelocityGuard();
+
+    // Appelés sous le verrou exclusif de la banque
+    // Efface les compteurs; maxCounterpartiesPerHour est plafonné
+    void configure(const VelocityLimits& limits);
+    void addAccount(AccountHandle handle);
+
+    bool isEnabled() const { return enabled; }
+    const VelocityLimits& getLimits() const { return limits; }
+
+    // OK ou LIMIT_EXCEEDED si le débit ferait dépasser une limite.
+    // counterparty vaut NO_ACCOUNT pour un retrait.
+    OperationStatus check(AccountHandle account, AccountHandle counterparty,
+        Money amount, int64_t now) const;
+    // Compte un débit effectué
+    void record(AccountHandle account, AccountHandle counterparty,
+        Money amount, int64_t now);
+
+    // Secondes d'une horloge monotone
+    static int64_t currentTime();
+};
+
+#endif // VELOCITYGUARD_H
\ No newline at end of file
@@ -0,0 +1,135 @@
+// bench_batch.cpp - lots de règlement: lot accepté contre les mêmes
+// opérations une à une, puis lot refusé par une dernière opération invalide
+// Usage: bench_batch [comptes] [opérations par lot]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Deux banques identiques, comptes ouverts dans le même ordre
+static vector<string> populate(Bank& bank, int accountCount) {
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<string> numbers;
+    for (int i = 0; i < accountCount; i++) {
+        int clientId = bank.addClient("Prenom", "Nom", addr);
+        numbers.push_back(bank.openAccount(clientId, AccountType::CHECKING, Money(1000.0)));
+    }
+    return numbers;
+}
+
+static vector<int64_t> balancesOf(const Bank& bank) {
+    vector<int64_t> balances;
+    for (BankAccount* account : bank.getAccountsView()) {
+        balances.push_back(account->getBalance().getCents());
+    }
+    return balances;
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 10000;
+    int operationCount = argc > 2 ? atoi(argv[2]) : 100000;
+    if (accountCount < 2) accountCount = 2;
+    if (operationCount < 2) operationCount = 2;
+
+    cout << "=== LOTS DE REGLEMENT ===" << endl;
+    cout << "Comptes: " << accountCount << " Operations par lot: " << operationCount << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank batched("Banque des lots", "001");
+    Bank single("Banque unitaire", "002");
+    vector<string> batchedNumbers = populate(batched, accountCount);
+    vector<string> singleNumbers = populate(single, accountCount);
+    cout.rdbuf(console);
+
+    // Montants petits devant les soldes: chaque opération est valide
+    mt19937 rng(9);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    vector<BatchOperation> operations;
+    vector<BatchOperation> singleOperations;
+    for (int i = 0; i < operationCount; i++) {
+        int from = pick(rng);
+        int to = (from + 1 + pick(rng) % (accountCount - 1)) % accountCount;
+        Money amount = Money::fromCents(1 + pick(rng) % 100);
+        TransactionType type = i % 4 == 0 ? TransactionType::DEPOSIT
+            : i % 4 == 1 ? TransactionType::WITHDRAWAL : TransactionType::TRANSFER;
+        operations.push_back({ type, batchedNumbers[from], batchedNumbers[to], amount });
+        singleOperations.push_back({ type, singleNumbers[from], singleNumbers[to], amount });
+    }
+
+    vector<OperationStatus> statuses;
+    auto start = chrono::steady_clock::now();
+    bool applied = batched.applyBatch(operations, statuses);
+    double batchSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    for (const BatchOperation& operation : singleOperations) {
+        AccountHandle from = single.getAccountHandle(operation.fromAccount);
+        AccountHandle to = single.getAccountHandle(operation.toAccount);
+        switch (operation.type) {
+        case TransactionType::DEPOSIT: single.tryDeposit(to, operation.amount); break;
+        case TransactionType::WITHDRAWAL: single.tryWithdraw(from, operation.amount); break;
+        default: single.tryTransfer(from, to, operation.amount); break;
+        }
+    }
+    double singleSeconds = secondsSince(start);
+
+    bool sameResult = applied && balancesOf(batched) == balancesOf(single);
+    for (OperationStatus status : statuses) {
+        sameResult = sameResult && status == OperationStatus::OK;
+    }
+    cout << "mode=unitaire ops/s=" << (long long)(operationCount / singleSeconds) << endl;
+    cout << "mode=lot      ops/s=" << (long long)(operationCount / batchSeconds)
+        << " acceleration=x" << singleSeconds / batchSeconds
+        << " coherent=" << (sameResult ? "oui" : "NON") << endl;
+
+    // Lot refusé: la dernière opération dépasse le solde, rien ne change
+    vector<int64_t> balancesBefore = balancesOf(batched);
+    Money totalBefore = batched.getTotalBankBalance();
+    Money depositsBefore = batched.getTransactionTotal(TransactionType::DEPOSIT);
+    int transactionsBefore = Transaction::getTotalTransactions();
+    size_t historyBefore = batched.getAccountTransactions(batchedNumbers[0]).size();
+
+    operations.push_back({ TransactionType::WITHDRAWAL, batchedNumbers[0], "", Money(1e9) });
+    operations.push_back({ TransactionType::DEPOSIT, "", "inconnu", Money(1.0) });
+    bool refused = !batched.applyBatch(operations, statuses);
+
+    bool statusesOk = statuses.size() == operations.size()
+        && statuses[operations.size() - 2] == OperationStatus::INSUFFICIENT_FUNDS
+        && statuses[operations.size() - 1] == OperationStatus::NOT_FOUND;
+    for (size_t i = 0; statusesOk && i + 2 < statuses.size(); i++) {
+        statusesOk = statuses[i] == OperationStatus::REJECTED;
+    }
+    bool unchanged = balancesOf(batched) == balancesBefore
+        && batched.getTotalBankBalance() == totalBefore
+        && batched.getTransactionTotal(TransactionType::DEPOSIT) == depositsBefore
+        && Transaction::getTotalTransactions() == transactionsBefore
+        && batched.getAccountTransactions(batchedNumbers[0]).size() == historyBefore;
+
+    cout << "lot refuse=" << (refused ? "oui" : "NON")
+        << " statuts=" << (statusesOk ? "ok" : "FAUX")
+        << " inchange=" << (unchanged ? "oui" : "NON")
+        << " statistiques=" << (batched.verifyStatistics() ? "ok" : "FAUX") << endl;
+
+    return 0;
+}
\ No newline at end of file
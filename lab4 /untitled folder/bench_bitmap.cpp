@@ -0,0 +1,83 @@
+// bench_bitmap.cpp - comptes "épargne actifs": parcours des objets compte
+// contre intersection des index bitmap (BitmapIndex)
+// Usage: bench_bitmap [comptes] [requêtes]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+int main(int argc, char* argv[]) {
+    long long accountCount = argc > 1 ? atoll(argv[1]) : 1000000;
+    int queryCount = argc > 2 ? atoi(argv[2]) : 100;
+    if (accountCount < 1) accountCount = 1;
+    if (queryCount < 1) queryCount = 1;
+
+    cout << "=== INDEX BITMAP PAR TYPE ET STATUT ===" << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque des index", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    mt19937 rng(24);
+    for (long long i = 0; i < accountCount; i++) {
+        ClientType clientType = rng() % 10 == 0 ? ClientType::PREMIUM : ClientType::REGULAR;
+        int clientId = bank.addClient("Prenom", "Nom", addr, clientType);
+        AccountType type = rng() % 3 == 0 ? AccountType::SAVINGS : AccountType::CHECKING;
+        string number = bank.openAccount(clientId, type, Money());
+        switch (rng() % 8) {
+        case 0: bank.tryFreezeAccount(bank.getAccountHandle(number)); break;
+        case 1: bank.closeAccount(number); break;
+        default: break;
+        }
+    }
+    cout.rdbuf(console);
+
+    cout << "Comptes: " << accountCount << " Requetes: " << queryCount << endl;
+
+    // Parcours: un pointeur suivi par compte
+    int scanned = 0;
+    auto start = chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        scanned = 0;
+        for (BankAccount* account : bank.getAccountsView()) {
+            scanned += account->getType() == AccountType::SAVINGS
+                && account->getStatus() == AccountStatus::ACTIVE;
+        }
+    }
+    double scanSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Bitmaps: popcount sur les cartes de bits
+    int counted = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        counted = bank.getAccountsCount(AccountType::SAVINGS, AccountStatus::ACTIVE);
+    }
+    double bitmapSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "mode=parcours resultat=" << scanned
+        << " temps/requete=" << scanSeconds / queryCount * 1e6 << "us" << endl;
+    cout << "mode=bitmap   resultat=" << counted
+        << " temps/requete=" << bitmapSeconds / queryCount * 1e6 << "us"
+        << " acceleration=x" << scanSeconds / bitmapSeconds
+        << " coherent=" << (scanned == counted ? "oui" : "NON") << endl;
+    cout << "clients premium=" << bank.getClientsCount(ClientType::PREMIUM)
+        << " statistiques=" << (bank.verifyStatistics() ? "ok" : "FAUX") << endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+// bench_client_names.cpp - recherche de clients par nom complet et par
+// préfixe du nom de famille: parcours de getAllClients() contre l'index
+// (ClientNameIndex), avant et après des changements de nom
+// Usage: bench_client_names [clients] [requêtes]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static const char* const FIRST_NAMES[] = { "Jean", "Marie", "Pierre", "Anne", "Luc",
+    "Sophie", "Paul", "Claire", "Louis", "Julie" };
+static const char* const SYLLABLES[] = { "ma", "ri", "du", "pon", "le", "ber", "tin",
+    "mo", "reau", "ga", "ro", "vin" };
+
+static string randomLastName(mt19937& rng) {
+    string name;
+    int length = 2 + rng() % 3;
+    for (int i = 0; i < length; i++) {
+        name += SYLLABLES[rng() % 12];
+    }
+    name[0] = (char)(name[0] - 'a' + 'A');
+    return name;
+}
+
+// Même requête, autre casse et espaces superflus: l'index normalise
+static string noisy(const string& name) {
+    string result = "  ";
+    for (char c : name) {
+        result += (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+    }
+    return result + " ";
+}
+
+// Parcours: premier client (ordre d'ajout) portant ce nom, 0 sinon
+static int scanFullName(const vector<shared_ptr<Client>>& all, const string& firstName,
+    const string& lastName) {
+    string first = ClientNameIndex::normalize(firstName);
+    string last = ClientNameIndex::normalize(lastName);
+    for (const auto& client : all) {
+        if (ClientNameIndex::normalize(client->getFirstName()) == first
+            && ClientNameIndex::normalize(client->getLastName()) == last) {
+            return client->getId();
+        }
+    }
+    return 0;
+}
+
+// Parcours: noms de famille commençant par prefix, triés, les limit premiers
+static vector<string> scanPrefix(const vector<shared_ptr<Client>>& all, const string& prefix,
+    size_t limit) {
+    string key = ClientNameIndex::normalize(prefix);
+    vector<string> names;
+    for (const auto& client : all) {
+        string last = ClientNameIndex::normalize(client->getLastName());
+        if (last.compare(0, key.size(), key) == 0) {
+            names.push_back(last);
+        }
+    }
+    sort(names.begin(), names.end());
+    if (names.size() > limit) {
+        names.resize(limit);
+    }
+    return names;
+}
+
+struct CheckResult {
+    bool consistent;
+    double scanSeconds;
+    double indexSeconds;
+};
+
+static CheckResult check(const Bank& bank, const vector<pair<string, string>>& queries,
+    const vector<string>& prefixes) {
+    CheckResult result = { true, 0, 0 };
+    vector<shared_ptr<Client>> all = bank.getAllClients();
+
+    auto start = chrono::steady_clock::now();
+    vector<int> expectedIds;
+    vector<vector<string>> expectedNames;
+    for (const auto& query : queries) {
+        expectedIds.push_back(scanFullName(all, query.first, query.second));
+    }
+    for (const string& prefix : prefixes) {
+        expectedNames.push_back(scanPrefix(all, prefix, 20));
+    }
+    result.scanSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<shared_ptr<Client>> found;
+    vector<vector<shared_ptr<Client>>> completions;
+    for (const auto& query : queries) {
+        found.push_back(bank.findClient(noisy(query.first), noisy(query.second)));
+    }
+    for (const string& prefix : prefixes) {
+        completions.push_back(bank.findClientsByLastNamePrefix(noisy(prefix), 20));
+    }
+    result.indexSeconds = secondsSince(start);
+
+    // Homonymes: l'index peut rendre un autre client du même nom
+    for (size_t i = 0; result.consistent && i < queries.size(); i++) {
+        if (expectedIds[i] == 0) {
+            result.consistent = found[i] == nullptr;
+        }
+        else {
+            result.consistent = found[i] && scanFullName({ found[i] }, queries[i].first,
+                queries[i].second) == found[i]->getId();
+        }
+    }
+    for (size_t i = 0; result.consistent && i < prefixes.size(); i++) {
+        result.consistent = completions[i].size() == expectedNames[i].size();
+        for (size_t j = 0; result.consistent && j < completions[i].size(); j++) {
+            result.consistent = ClientNameIndex::normalize(completions[i][j]->getLastName())
+                == expectedNames[i][j];
+        }
+    }
+    return result;
+}
+
+static void report(const char* phase, const CheckResult& result, size_t queryCount) {
+    cout << phase << " parcours/requete=" << result.scanSeconds / queryCount * 1e6 << "us"
+        << " index/requete=" << result.indexSeconds / queryCount * 1e6 << "us"
+        << " acceleration=x" << result.scanSeconds / result.indexSeconds
+        << " coherent=" << (result.consistent ? "oui" : "NON") << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int clientCount = argc > 1 ? atoi(argv[1]) : 100000;
+    int queryCount = argc > 2 ? atoi(argv[2]) : 200;
+    if (clientCount < 1) clientCount = 1;
+    if (queryCount < 1) queryCount = 1;
+
+    cout << "=== RECHERCHE DE CLIENTS PAR NOM ===" << endl;
+    cout << "Clients: " << clientCount << " Requetes: " << queryCount << " x2" << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque des noms", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    mt19937 rng(11);
+    vector<int> clientIds;
+    for (int i = 0; i < clientCount; i++) {
+        clientIds.push_back(bank.addClient(FIRST_NAMES[rng() % 10], randomLastName(rng), addr));
+    }
+    cout.rdbuf(console);
+
+    // Moitié de noms existants, moitié de noms probablement absents;
+    // préfixes de une à quatre lettres
+    vector<pair<string, string>> queries;
+    vector<string> prefixes;
+    for (int q = 0; q < queryCount; q++) {
+        shared_ptr<Client> client = bank.findClient(clientIds[rng() % clientIds.size()]);
+        if (q % 2 == 0) {
+            queries.push_back({ client->getFirstName(), client->getLastName() });
+        }
+        else {
+            queries.push_back({ FIRST_NAMES[rng() % 10], randomLastName(rng) });
+        }
+        prefixes.push_back(client->getLastName().substr(0, 1 + q % 4));
+    }
+
+    report("avant", check(bank, queries, prefixes), queries.size() + prefixes.size());
+
+    // Changements de nom: un sur dix par la banque, un sur dix par le client
+    // (mode simple, l'observateur réindexe)
+    for (size_t i = 0; i < clientIds.size(); i += 5) {
+        string lastName = randomLastName(rng);
+        bank.renameClient(clientIds[i], FIRST_NAMES[rng() % 10], lastName);
+        if (i + 1 < clientIds.size()) {
+            Client* client = bank.getClient(clientIds[i + 1]);
+            client->setFirstName(FIRST_NAMES[rng() % 10]);
+            client->setLastName(lastName);
+        }
+    }
+
+    report("apres", check(bank, queries, prefixes), queries.size() + prefixes.size());
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+// bench_concurrent_transfers.cpp - transferts aléatoires depuis N threads
+// Usage: bench_concurrent_transfers [transferts] [comptes] [threads max]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: les comptes écrivent un message par opération
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+struct RunResult {
+    double seconds;
+    long long succeeded;
+};
+
+static RunResult runTransfers(int threadCount, long long totalTransfers, int accountCount) {
+    Bank bank("Banque de test", "999");
+    bank.setThreadSafe(true);
+
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    int clientId = bank.addClient("Test", "Charge", addr);
+
+    vector<AccountHandle> accountHandles;
+    accountHandles.reserve(accountCount);
+    for (int i = 0; i < accountCount; i++) {
+        string number = bank.openAccount(clientId, AccountType::CHECKING, Money(1000000.0));
+        accountHandles.push_back(bank.getAccountHandle(number));
+    }
+
+    atomic<long long> succeeded{ 0 };
+    long long perThread = totalTransfers / threadCount;
+
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(12345 + t);
+            uniform_int_distribution<int> pick(0, accountCount - 1);
+            long long ok = 0;
+            for (long long i = 0; i < perThread; i++) {
+                int from = pick(rng);
+                int to = pick(rng);
+                if (from == to) {
+                    to = (to + 1) % accountCount;
+                }
+                if (bank.tryTransfer(accountHandles[from], accountHandles[to],
+                    Money::fromCents(100)) == OperationStatus::OK) {
+                    ok++;
+                }
+            }
+            succeeded += ok;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto end = chrono::steady_clock::now();
+    return { chrono::duration<double>(end - start).count(), succeeded.load() };
+}
+
+int main(int argc, char* argv[]) {
+    long long totalTransfers = argc > 1 ? atoll(argv[1]) : 2000000;
+    int accountCount = argc > 2 ? atoi(argv[2]) : 10000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+    if (accountCount < 2) accountCount = 2;
+
+    cout << "=== TRANSFERTS CONCURRENTS ===" << endl;
+    cout << "Transferts: " << totalTransfers << ", comptes: " << accountCount << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        cout.rdbuf(&nullBuffer);
+        RunResult result = runTransfers(threads, totalTransfers, accountCount);
+        cout.rdbuf(console);
+
+        cout << "threads=" << threads
+            << " ops/s=" << (long long)(result.succeeded / result.seconds)
+            << " temps=" << result.seconds << "s"
+            << " reussis=" << result.succeeded << endl;
+    }
+
+    return 0;
+}
\ No newline at end of file
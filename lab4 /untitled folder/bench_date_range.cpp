@@ -0,0 +1,204 @@
+// bench_date_range.cpp - transactions par période: parcours de toutes les
+// opérations contre les partitions par jour (getTransactions(from, to)).
+// Le journal rejoué porte des dates réparties sur un an, dans le désordre.
+// Usage: bench_date_range [comptes] [opérations] [requêtes] [fichier]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "Bank.h"
+#include "Journal.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la reprise
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+// Opération écrite dans le journal: la référence du parcours naïf
+struct LoggedOperation {
+    int id;
+    int32_t day;
+    int from;   // indice du compte, -1 si aucun
+    int to;
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static int32_t journalDate(int32_t dayNumber) {
+    Date date = Date::fromDayNumber(dayNumber);
+    return date.getYear() * 10000 + date.getMonth() * 100 + date.getDay();
+}
+
+static string accountNumber(int index) {
+    return "DR" + to_string(index);
+}
+
+// Parcours: opérations de la période (d'un compte si account >= 0), par
+// date puis ordre d'ajout
+static vector<int> scan(const vector<LoggedOperation>& log, int32_t fromDay, int32_t toDay,
+    int account) {
+    vector<const LoggedOperation*> selected;
+    for (const LoggedOperation& operation : log) {
+        if (operation.day >= fromDay && operation.day <= toDay
+            && (account < 0 || operation.from == account || operation.to == account)) {
+            selected.push_back(&operation);
+        }
+    }
+    stable_sort(selected.begin(), selected.end(),
+        [](const LoggedOperation* a, const LoggedOperation* b) { return a->day < b->day; });
+    vector<int> ids;
+    for (const LoggedOperation* operation : selected) {
+        ids.push_back(operation->id);
+    }
+    return ids;
+}
+
+static vector<int> idsOf(const vector<Transaction>& transactions) {
+    vector<int> ids;
+    for (const Transaction& transaction : transactions) {
+        ids.push_back(transaction.getId());
+    }
+    return ids;
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 10000;
+    long long operationCount = argc > 2 ? atoll(argv[2]) : 1000000;
+    int queryCount = argc > 3 ? atoi(argv[3]) : 100;
+    string filename = argc > 4 ? argv[4] : "bench_date_range.bin";
+    if (accountCount < 2) accountCount = 2;
+    if (queryCount < 1) queryCount = 1;
+
+    cout << "=== TRANSACTIONS PAR PERIODE ===" << endl;
+    cout << "Comptes: " << accountCount << " Operations: " << operationCount << endl;
+
+    // Journal écrit directement: la banque date tout du jour courant
+    const int32_t firstDay = Date(1, 1, 2024).toDayNumber();
+    const int32_t dayCount = 365;
+    vector<LoggedOperation> log;
+    mt19937 rng(13);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    uniform_int_distribution<int32_t> pickDay(0, dayCount - 1);
+    int nextId = 1;
+
+    remove(filename.c_str());
+    Journal journal;
+    if (!journal.open(filename)) {
+        cout << "Erreur: journal " << filename << " impossible a ouvrir" << endl;
+        return 1;
+    }
+    for (int i = 0; i < accountCount; i++) {
+        // L'ajout d'un client est lui aussi une transaction (sans compte)
+        JournalRecord client;
+        client.type = (uint8_t)JournalRecordType::ADD_CLIENT;
+        client.clientType = (uint8_t)ClientType::REGULAR;
+        client.clientId = i + 1;
+        client.transactionId = nextId;
+        client.date = journalDate(firstDay);
+        JournalRecord::writeField(client.firstName, sizeof(client.firstName), "Prenom");
+        JournalRecord::writeField(client.lastName, sizeof(client.lastName), "Nom");
+        journal.append(client);
+        log.push_back({ nextId++, firstDay, -1, -1 });
+
+        JournalRecord open;
+        open.type = (uint8_t)JournalRecordType::OPEN_ACCOUNT;
+        open.accountType = (uint8_t)AccountType::CHECKING;
+        open.clientId = i + 1;
+        open.transactionId = nextId;
+        open.date = journalDate(firstDay);
+        open.amountCents = 100000;
+        JournalRecord::writeField(open.toAccount, sizeof(open.toAccount), accountNumber(i));
+        journal.append(open);
+        log.push_back({ nextId++, firstDay, -1, i });
+    }
+    for (long long i = 0; i < operationCount; i++) {
+        int from = pick(rng);
+        int to = pick(rng);
+        int32_t day = firstDay + pickDay(rng);
+        JournalRecord record;
+        record.transactionId = nextId;
+        record.date = journalDate(day);
+        record.amountCents = 1 + pick(rng) % 100;
+        if (i % 2 == 0) {
+            record.type = (uint8_t)JournalRecordType::DEPOSIT;
+            from = -1;
+        }
+        else {
+            record.type = (uint8_t)JournalRecordType::TRANSFER;
+            JournalRecord::writeField(record.fromAccount, sizeof(record.fromAccount),
+                accountNumber(from));
+        }
+        JournalRecord::writeField(record.toAccount, sizeof(record.toAccount), accountNumber(to));
+        journal.append(record);
+        log.push_back({ nextId++, day, from, to });
+    }
+    bool written = journal.flush();
+    journal.close();
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+    Bank bank("Banque des periodes", "001");
+    bool recovered = written && bank.recoverFromJournal(filename);
+    cout.rdbuf(console);
+    remove(filename.c_str());
+    if (!recovered) {
+        cout << "Erreur: reprise du journal impossible" << endl;
+        return 1;
+    }
+
+    // Périodes d'un jour à un trimestre; la moitié des requêtes sur un compte
+    vector<int32_t> fromDays;
+    vector<int32_t> toDays;
+    vector<int> queryAccounts;
+    for (int q = 0; q < queryCount; q++) {
+        int32_t from = firstDay + pickDay(rng);
+        int32_t length = q % 3 == 0 ? 0 : (q % 3 == 1 ? 6 : 90);
+        fromDays.push_back(from);
+        toDays.push_back(from + length);
+        queryAccounts.push_back(q % 2 == 0 ? -1 : pick(rng));
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<vector<int>> expected;
+    for (int q = 0; q < queryCount; q++) {
+        expected.push_back(scan(log, fromDays[q], toDays[q], queryAccounts[q]));
+    }
+    double scanSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<vector<int>> found;
+    for (int q = 0; q < queryCount; q++) {
+        Date from = Date::fromDayNumber(fromDays[q]);
+        Date to = Date::fromDayNumber(toDays[q]);
+        found.push_back(idsOf(queryAccounts[q] < 0 ? bank.getTransactions(from, to)
+            : bank.getAccountTransactions(accountNumber(queryAccounts[q]), from, to)));
+    }
+    double indexSeconds = secondsSince(start);
+
+    size_t rows = 0;
+    bool consistent = true;
+    for (int q = 0; q < queryCount; q++) {
+        rows += found[q].size();
+        consistent = consistent && found[q] == expected[q];
+    }
+
+    cout << "parcours/requete=" << scanSeconds / queryCount * 1e3 << "ms"
+        << " partitions/requete=" << indexSeconds / queryCount * 1e3 << "ms"
+        << " acceleration=x" << scanSeconds / indexSeconds
+        << " lignes/requete=" << rows / queryCount
+        << " coherent=" << (consistent ? "oui" : "NON") << endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+// bench_history.cpp - historique d'un compte: parcours de toutes les
+// opérations contre l'index par compte (getAccountTransactions)
+// Usage: bench_history [comptes] [opérations] [requêtes]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+// Opération réussie, notée par le pilote: la référence du parcours naïf
+struct LoggedOperation {
+    TransactionType type;
+    AccountHandle from;
+    AccountHandle to;
+    Money amount;
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 100000;
+    long long operationCount = argc > 2 ? atoll(argv[2]) : 1000000;
+    int queryCount = argc > 3 ? atoi(argv[3]) : 200;
+    if (accountCount < 2) accountCount = 2;
+    if (queryCount < 1) queryCount = 1;
+
+    cout << "=== HISTORIQUE PAR COMPTE ===" << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque des historiques", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<AccountHandle> handles;
+    vector<LoggedOperation> log;
+    for (int i = 0; i < accountCount; i++) {
+        int clientId = bank.addClient("Prenom", "Nom", addr);
+        AccountHandle handle = bank.getAccountHandle(
+            bank.openAccount(clientId, AccountType::CHECKING, Money(50.0)));
+        handles.push_back(handle);
+        log.push_back({ TransactionType::OPEN_ACCOUNT, NO_ACCOUNT, handle, Money(50.0) });
+    }
+    cout.rdbuf(console);
+
+    mt19937 rng(4);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    for (long long i = 0; i < operationCount; i++) {
+        AccountHandle from = handles[pick(rng)];
+        AccountHandle to = handles[pick(rng)];
+        Money amount = Money::fromCents(1 + pick(rng) % 4000);
+        switch (i % 3) {
+        case 0:
+            if (bank.tryDeposit(to, amount) == OperationStatus::OK) {
+                log.push_back({ TransactionType::DEPOSIT, NO_ACCOUNT, to, amount });
+            }
+            break;
+        case 1:
+            if (bank.tryWithdraw(from, amount) == OperationStatus::OK) {
+                log.push_back({ TransactionType::WITHDRAWAL, from, NO_ACCOUNT, amount });
+            }
+            break;
+        default:
+            if (bank.tryTransfer(from, to, amount) == OperationStatus::OK) {
+                log.push_back({ TransactionType::TRANSFER, from, to, amount });
+            }
+            break;
+        }
+    }
+
+    cout << "Comptes: " << accountCount << " Transactions: " << log.size()
+        << " Requetes: " << queryCount << endl;
+
+    vector<AccountHandle> queries;
+    for (int q = 0; q < queryCount; q++) {
+        queries.push_back(handles[pick(rng)]);
+    }
+
+    // Parcours: toutes les opérations pour chaque compte demandé
+    vector<vector<const LoggedOperation*>> expected(queryCount);
+    auto start = chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        for (const LoggedOperation& operation : log) {
+            if (operation.from == queries[q] || operation.to == queries[q]) {
+                expected[q].push_back(&operation);
+            }
+        }
+    }
+    double scanSeconds = secondsSince(start);
+
+    // Index: les positions des transactions du compte seulement
+    size_t found = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        found += bank.getAccountTransactions(queries[q]).size();
+    }
+    double indexSeconds = secondsSince(start);
+
+    // Même suite, dans le même ordre
+    bool consistent = true;
+    for (int q = 0; consistent && q < queryCount; q++) {
+        TransactionRange range = bank.getAccountTransactions(queries[q]);
+        consistent = range.size() == expected[q].size();
+        size_t i = 0;
+        for (Transaction transaction : range) {
+            if (!consistent) {
+                break;
+            }
+            const LoggedOperation& operation = *expected[q][i++];
+            consistent = transaction.getType() == operation.type
+                && transaction.getFromHandle() == operation.from
+                && transaction.getToHandle() == operation.to
+                && transaction.getAmount() == operation.amount;
+        }
+    }
+
+    cout << "mode=parcours temps/requete=" << scanSeconds / queryCount * 1e6 << "us" << endl;
+    cout << "mode=index    temps/requete=" << indexSeconds / queryCount * 1e6 << "us"
+        << " transactions=" << found
+        << " acceleration=x" << scanSeconds / indexSeconds
+        << " coherent=" << (consistent ? "oui" : "NON") << endl;
+
+    return 0;
+}
\ No newline at end of file
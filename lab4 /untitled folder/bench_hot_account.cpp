@@ -0,0 +1,76 @@
+// bench_hot_account.cpp - dépôts concurrents sur un seul compte marchand:
+// compte classique (verrou du compte) contre compte chaud (sous-soldes par thread)
+// Usage: bench_hot_account [dépôts] [threads max]
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <cstdlib>
+#include "BankAccount.h"
+
+using namespace std;
+
+struct RunResult {
+    double seconds;
+    bool balanceOk;
+};
+
+static RunResult runDeposits(bool hot, int threadCount, long long totalDeposits) {
+    BankAccount account(1, AccountType::CHECKING);
+    account.setHot(hot);
+
+    long long perThread = totalDeposits / threadCount;
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&]() {
+            for (long long i = 0; i < perThread; i++) {
+                if (hot) {
+                    account.tryDeposit(Money::fromCents(1));
+                }
+                else {
+                    lock_guard<mutex> guard(account.getMutex());
+                    account.tryDeposit(Money::fromCents(1));
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto end = chrono::steady_clock::now();
+    bool balanceOk = account.getBalance() == Money::fromCents(perThread * threadCount);
+    return { chrono::duration<double>(end - start).count(), balanceOk };
+}
+
+int main(int argc, char* argv[]) {
+    long long totalDeposits = argc > 1 ? atoll(argv[1]) : 8000000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    cout << "=== DEPOTS SUR UN COMPTE CHAUD ===" << endl;
+    cout << "Depots: " << totalDeposits << endl;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        for (bool hot : { false, true }) {
+            RunResult result = runDeposits(hot, threads, totalDeposits);
+            long long done = totalDeposits / threads * threads;
+            cout << "mode=" << (hot ? "chaud " : "verrou")
+                << " threads=" << threads
+                << " ops/s=" << (long long)(done / result.seconds)
+                << " temps=" << result.seconds << "s"
+                << " solde=" << (result.balanceOk ? "ok" : "FAUX") << endl;
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
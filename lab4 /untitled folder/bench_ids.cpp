@@ -0,0 +1,95 @@
+// bench_ids.cpp - attribution d'identifiants: compteur atomique partagé
+// contre blocs réservés par thread (IdService), et formatage des numéros
+// de compte (stringstream contre to_chars)
+// Usage: bench_ids [identifiants par thread] [threads max]
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include "IdService.h"
+
+using namespace std;
+
+static atomic<int64_t> sharedCounter(0);
+
+// Chaque thread garde ses identifiants pour vérifier l'unicité
+static double runThreads(int threadCount, long long perThread, bool blocks, bool& unique) {
+    vector<vector<int64_t>> ids(threadCount, vector<int64_t>((size_t)perThread));
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            int64_t* out = ids[t].data();
+            for (long long i = 0; i < perThread; i++) {
+                out[i] = blocks ? IdService::next(IdKind::TRANSACTION)
+                    : sharedCounter.fetch_add(1, memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<int64_t> all;
+    for (const auto& threadIds : ids) {
+        all.insert(all.end(), threadIds.begin(), threadIds.end());
+    }
+    sort(all.begin(), all.end());
+    unique = adjacent_find(all.begin(), all.end()) == all.end();
+    return seconds;
+}
+
+int main(int argc, char* argv[]) {
+    long long perThread = argc > 1 ? atoll(argv[1]) : 10000000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    cout << "=== ATTRIBUTION D'IDENTIFIANTS ===" << endl;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        for (bool blocks : { false, true }) {
+            bool unique = false;
+            double seconds = runThreads(threads, perThread, blocks, unique);
+            cout << "mode=" << (blocks ? "blocs   " : "partage ")
+                << " threads=" << threads
+                << " ids/s=" << (long long)(perThread * threads / seconds)
+                << " temps=" << seconds << "s"
+                << " uniques=" << (unique ? "oui" : "NON") << endl;
+        }
+    }
+
+    // Numéros de compte
+    long long numbers = min(perThread, 2000000LL);
+    size_t checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < numbers; i++) {
+        stringstream ss;
+        ss << "ACC" << setw(7) << setfill('0') << (1000 + i);
+        checksum += ss.str().size();
+    }
+    double streamSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (long long i = 0; i < numbers; i++) {
+        checksum += IdService::formatAccountNumber(1000 + i).size();
+    }
+    double charsSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "numeros stringstream ns/op=" << streamSeconds * 1e9 / numbers
+        << " to_chars ns/op=" << charsSeconds * 1e9 / numbers
+        << " (" << checksum << ")" << endl;
+    return 0;
+}
\ No newline at end of file
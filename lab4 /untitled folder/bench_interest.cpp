@@ -0,0 +1,116 @@
+// bench_interest.cpp - intérêts et frais: moteur seul sur une colonne de
+// soldes, puis Bank::applyInterest sur une banque de comptes épargne
+// Usage: bench_interest [soldes] [comptes] [threads max]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: la banque écrit un message par ouverture de compte
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static InterestSchedule nightlySchedule() {
+    InterestSchedule schedule;
+    schedule.tiers = {
+        { Money(), 0.005 },
+        { Money(1000.0), 0.015 },
+        { Money(10000.0), 0.025 },
+        { Money(100000.0), 0.01 }
+    };
+    schedule.periodDays = 1;
+    schedule.fee = Money(0.10);
+    schedule.feeWaiverBalance = Money(500.0);
+    return schedule;
+}
+
+int main(int argc, char* argv[]) {
+    size_t balanceCount = argc > 1 ? (size_t)atoll(argv[1]) : 10000000;
+    int accountCount = argc > 2 ? atoi(argv[2]) : 200000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    cout << "=== INTERETS DES COMPTES EPARGNE ===" << endl;
+
+    mt19937_64 rng(2024);
+    uniform_int_distribution<int64_t> pick(0, 50000000); // jusqu'à 500 000.00
+    vector<int64_t> balances(balanceCount);
+    for (int64_t& balance : balances) {
+        balance = pick(rng);
+    }
+    vector<int64_t> interest(balanceCount);
+    vector<int64_t> fees(balanceCount);
+    InterestEngine engine(nightlySchedule());
+
+    // Référence sur un thread, comparée à chaque calcul parallèle
+    vector<int64_t> expectedInterest(balanceCount);
+    vector<int64_t> expectedFees(balanceCount);
+    engine.compute(balances.data(), expectedInterest.data(), expectedFees.data(), balanceCount);
+
+    // Découpage: nombres de lignes qui ne tombent pas sur threads * bloc
+    bool splitOk = true;
+    for (size_t rows : { size_t(3 * 65536 + 2), size_t(4 * 65536 + 1023), size_t(5 * 65536 - 1) }) {
+        rows = min(rows, balanceCount);
+        for (unsigned threads = 2; threads <= 5; threads++) {
+            fill(interest.begin(), interest.end(), -1);
+            fill(fees.begin(), fees.end(), -1);
+            engine.computeParallel(balances.data(), interest.data(), fees.data(), rows, threads);
+            splitOk = splitOk && equal(interest.begin(), interest.begin() + rows, expectedInterest.begin())
+                && equal(fees.begin(), fees.begin() + rows, expectedFees.begin());
+        }
+    }
+    cout << "Decoupage en tranches: " << (splitOk ? "ok" : "LIGNES MANQUANTES") << endl;
+
+    cout << "Moteur, soldes: " << balanceCount << endl;
+    for (int threads = 1; ; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads) {
+        fill(interest.begin(), interest.end(), -1);
+        auto start = chrono::steady_clock::now();
+        engine.computeParallel(balances.data(), interest.data(), fees.data(),
+            balanceCount, (unsigned)threads);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        bool same = interest == expectedInterest && fees == expectedFees;
+        cout << "threads=" << threads
+            << " soldes/s=" << (long long)(balanceCount / seconds)
+            << " temps=" << seconds << "s"
+            << " coherent=" << (same ? "oui" : "NON") << endl;
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque de test", "999");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    int clientId = bank.addClient("Test", "Epargne", addr);
+    for (int i = 0; i < accountCount; i++) {
+        bank.openAccount(clientId, AccountType::SAVINGS, Money::fromCents(pick(rng)));
+    }
+    cout.rdbuf(console);
+
+    auto start = chrono::steady_clock::now();
+    InterestSummary summary = bank.applyInterest(nightlySchedule());
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Banque, comptes: " << summary.accounts
+        << " temps=" << seconds << "s"
+        << " interets=" << summary.totalInterest
+        << " frais=" << summary.totalFees
+        << " statistiques=" << (bank.verifyStatistics() ? "ok" : "FAUSSES") << endl;
+
+    return 0;
+}
\ No newline at end of file
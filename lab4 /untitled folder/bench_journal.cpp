@@ -0,0 +1,168 @@
+// bench_journal.cpp - opérations journalisées puis reprise dans une banque
+// vide: débit du journal, durée de la reprise, et comparaison compte par
+// compte (numéro, client, statut, solde, date d'ouverture)
+// Usage: bench_journal [comptes] [opérations] [fichier]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: la banque écrit un message par opération
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 100000;
+    long long operationCount = argc > 2 ? atoll(argv[2]) : 1000000;
+    string filename = argc > 3 ? argv[3] : "bench_journal.bin";
+    if (accountCount < 4) accountCount = 4;
+    if (operationCount < 1) operationCount = 1;
+
+    cout << "=== JOURNAL ET REPRISE ===" << endl;
+    cout << "Comptes: " << accountCount << " Operations: " << operationCount << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    // Le journal s'ouvre en ajout: repartir d'un fichier vide
+    remove(filename.c_str());
+    Bank bank("Banque du journal", "001");
+    bool opened = bank.openJournal(filename);
+
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<int> clientIds;
+    vector<string> numbers;
+    for (int i = 0; i < accountCount; i++) {
+        if (i % 2 == 0) {
+            clientIds.push_back(bank.addClient("Prenom", "Nom" + to_string(i), addr,
+                i % 10 == 0 ? ClientType::PREMIUM : ClientType::REGULAR));
+        }
+        AccountType type = i % 3 == 0 ? AccountType::SAVINGS : AccountType::CHECKING;
+        numbers.push_back(bank.openAccount(clientIds.back(), type, Money(100.0)));
+    }
+
+    mt19937 rng(3);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < operationCount; i++) {
+        AccountHandle from = bank.getAccountHandle(numbers[pick(rng)]);
+        AccountHandle to = bank.getAccountHandle(numbers[pick(rng)]);
+        Money amount = Money::fromCents(1 + pick(rng) % 5000);
+        switch (i % 16) {
+        case 0: bank.tryFreezeAccount(from); break;
+        case 1: bank.tryActivateAccount(from); break;
+        case 2: case 3: case 4: bank.tryDeposit(to, amount); break;
+        case 5: case 6: bank.tryWithdraw(from, amount); break;
+        default: bank.tryTransfer(from, to, amount); break;
+        }
+    }
+    bool durable = bank.flushJournal();
+    double operationSeconds = secondsSince(start);
+
+    // Lot refusé, lot accepté et intérêts: journalisés en bloc
+    vector<OperationStatus> statuses;
+    bank.applyBatch({
+        { TransactionType::DEPOSIT, "", numbers[0], Money(5.0) },
+        { TransactionType::WITHDRAWAL, numbers[1], "", Money(1e9) } }, statuses);
+    bank.applyBatch({
+        { TransactionType::DEPOSIT, "", numbers[2], Money(5.0) },
+        { TransactionType::TRANSFER, numbers[2], numbers[3], Money(2.5) } }, statuses);
+    InterestSchedule schedule;
+    schedule.tiers = { { Money(), 0.02 }, { Money(1000.0), 0.03 } };
+    schedule.fee = Money(0.5);
+    schedule.feeWaiverBalance = Money(500.0);
+    bank.applyInterest(schedule);
+
+    // Client supprimé avec un compte gelé qui garde son solde: le compte
+    // reste gelé; un compte à zéro se ferme
+    int frozenOwner = bank.addClient("Gel", "Solde", addr);
+    AccountHandle frozen = bank.getAccountHandle(
+        bank.openAccount(frozenOwner, AccountType::CHECKING, Money(100.0)));
+    bank.tryFreezeAccount(frozen);
+    bank.removeClient(frozenOwner);
+    int emptyOwner = bank.addClient("Vide", "Solde", addr);
+    string emptyNumber = bank.openAccount(emptyOwner, AccountType::CHECKING, Money());
+    bank.removeClient(emptyOwner);
+    bank.closeAccount(bank.openAccount(clientIds[0], AccountType::SAVINGS, Money()));
+
+    durable = bank.flushJournal() && durable;
+    bank.closeJournal();
+
+    Bank recovered;
+    start = chrono::steady_clock::now();
+    bool replayed = recovered.recoverFromJournal(filename);
+    double recoverySeconds = secondsSince(start);
+    cout.rdbuf(console);
+
+    // Comparaison compte par compte, dans l'ordre d'ouverture
+    vector<shared_ptr<BankAccount>> live = bank.getAllAccounts();
+    vector<shared_ptr<BankAccount>> restored = recovered.getAllAccounts();
+    size_t mismatches = live.size() == restored.size() ? 0 : 1;
+    for (size_t i = 0; mismatches == 0 && i < live.size(); i++) {
+        const BankAccount& a = *live[i];
+        const BankAccount& b = *restored[i];
+        if (a.getAccountNumber() != b.getAccountNumber() || a.getClientId() != b.getClientId()
+            || a.getType() != b.getType() || a.getStatus() != b.getStatus()
+            || a.getBalance() != b.getBalance() || !(a.getOpeningDate() == b.getOpeningDate())
+            || bank.getAccountTransactions(a.getHandle()).size()
+                != recovered.getAccountTransactions(b.getHandle()).size()) {
+            mismatches++;
+        }
+    }
+    bool frozenKept = recovered.getAccount(frozen)->getStatus() == AccountStatus::FROZEN
+        && recovered.getAccount(emptyNumber)->getStatus() == AccountStatus::CLOSED;
+    bool totalsMatch = bank.getTotalClients() == recovered.getTotalClients()
+        && bank.getTotalBankBalance() == recovered.getTotalBankBalance()
+        && bank.getAccountsCount(AccountStatus::FROZEN) == recovered.getAccountsCount(AccountStatus::FROZEN)
+        && bank.getTotalBalance(AccountStatus::FROZEN) == recovered.getTotalBalance(AccountStatus::FROZEN);
+
+    cout << "journal ouvert=" << (opened ? "oui" : "NON")
+        << " sur disque=" << (durable ? "oui" : "NON")
+        << " ops/s=" << (long long)(operationCount / operationSeconds) << endl;
+    cout << "reprise=" << recoverySeconds * 1e3 << "ms"
+        << (replayed ? "" : " ECHEC") << " comptes=" << restored.size()
+        << " coherent=" << (mismatches == 0 && frozenKept && totalsMatch ? "oui" : "NON")
+        << " statistiques=" << (bank.verifyStatistics() && recovered.verifyStatistics() ? "ok" : "FAUX")
+        << endl;
+
+    // Suite du journal: ouvert sur une banque vide, puis rejoué; une banque
+    // non vide le refuse (son état ne serait pas dans le journal)
+    cout.rdbuf(&nullBuffer);
+    bool refused = !recovered.openJournal(filename);
+    Bank resumed;
+    bool resumedOk = resumed.openJournal(filename) && resumed.recoverFromJournal(filename);
+    AccountHandle active = NO_ACCOUNT;
+    for (const BankAccount* account : resumed.getAccountsView(
+        filters::accountStatus(AccountStatus::ACTIVE))) {
+        active = account->getHandle();
+    }
+    resumedOk = resumedOk && resumed.tryDeposit(active, Money(12.34)) == OperationStatus::OK
+        && resumed.flushJournal();
+    resumed.closeJournal();
+    Bank again;
+    resumedOk = resumedOk && again.recoverFromJournal(filename)
+        && again.getTotalBankBalance() == resumed.getTotalBankBalance()
+        && again.getAccount(active)->getBalance() == resumed.getAccount(active)->getBalance();
+    cout.rdbuf(console);
+    cout << "banque non vide refusee=" << (refused ? "oui" : "NON")
+        << " suite du journal=" << (resumedOk ? "ok" : "FAUX") << endl;
+
+    remove(filename.c_str());
+    return 0;
+}
\ No newline at end of file
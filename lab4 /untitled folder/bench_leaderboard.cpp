@@ -0,0 +1,194 @@
+// bench_leaderboard.cpp - plus gros soldes et comptes les plus actifs:
+// tri de getAllAccounts() et parcours des historiques, contre les
+// classements tenus à jour par la banque; puis dépôts concurrents (mode
+// multi-thread) pendant qu'un lecteur consulte le classement des soldes
+// Usage: bench_leaderboard [comptes] [transactions] [taille du classement]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Les n plus gros soldes par tri de getAllAccounts(), à égalité par handle
+static vector<AccountHandle> sortedTop(const Bank& bank, size_t n) {
+    vector<shared_ptr<BankAccount>> all = bank.getAllAccounts();
+    n = min(n, all.size());
+    partial_sort(all.begin(), all.begin() + n, all.end(),
+        [](const shared_ptr<BankAccount>& a, const shared_ptr<BankAccount>& b) {
+            if (a->getBalance() != b->getBalance()) {
+                return a->getBalance() > b->getBalance();
+            }
+            return a->getHandle() < b->getHandle();
+        });
+    vector<AccountHandle> handles;
+    for (size_t i = 0; i < n; i++) {
+        handles.push_back(all[i]->getHandle());
+    }
+    return handles;
+}
+
+// Dépôts répartis sur tous les comptes par threadCount threads, et un
+// lecteur qui demande le classement en boucle; puis comparaison au tri
+static void concurrentDeposits(const vector<AccountHandle>& handles, Bank& bank,
+    int threadCount, long long depositCount, size_t topCount) {
+    atomic<bool> running(true);
+    atomic<long long> reads(0);
+    thread reader([&]() {
+        while (running.load(memory_order_relaxed)) {
+            bank.getTopBalances(topCount);
+            reads.fetch_add(1, memory_order_relaxed);
+        }
+    });
+
+    long long perThread = depositCount / threadCount;
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(100 + t);
+            uniform_int_distribution<size_t> pick(0, handles.size() - 1);
+            for (long long i = 0; i < perThread; i++) {
+                bank.tryDeposit(handles[pick(rng)], Money::fromCents(1 + (long long)(rng() % 500)));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = secondsSince(start);
+    running.store(false, memory_order_relaxed);
+    reader.join();
+
+    vector<RankedAccount> top = bank.getTopBalances(topCount);
+    vector<AccountHandle> expected = sortedTop(bank, topCount);
+    bool consistent = top.size() == expected.size();
+    for (size_t i = 0; consistent && i < top.size(); i++) {
+        consistent = top[i].handle == expected[i];
+    }
+
+    cout << "threads=" << threadCount
+        << " depots/s=" << (long long)(perThread * threadCount / seconds)
+        << " lectures=" << reads.load()
+        << " coherent=" << (consistent ? "oui" : "NON")
+        << " statistiques=" << (bank.verifyStatistics() ? "ok" : "FAUX") << endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long accountCount = argc > 1 ? atoll(argv[1]) : 1000000;
+    long long transactionCount = argc > 2 ? atoll(argv[2]) : 2000000;
+    size_t topCount = argc > 3 ? (size_t)atoll(argv[3]) : 10;
+    if (accountCount < 2) accountCount = 2;
+    if (topCount < 1) topCount = 1;
+
+    cout << "=== CLASSEMENTS DES COMPTES ===" << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque des classements", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<AccountHandle> handles;
+    handles.reserve((size_t)accountCount);
+    for (long long i = 0; i < accountCount; i++) {
+        int clientId = bank.addClient("Prenom", "Nom", addr);
+        string number = bank.openAccount(clientId, AccountType::CHECKING, Money(1000.0));
+        handles.push_back(bank.getAccountHandle(number));
+    }
+
+    // Activité très inégale: quelques comptes marchands reçoivent beaucoup
+    mt19937 rng(25);
+    uniform_int_distribution<size_t> pick(0, handles.size() - 1);
+    geometric_distribution<size_t> merchant(0.01);
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < transactionCount; i++) {
+        AccountHandle from = handles[pick(rng)];
+        AccountHandle to = handles[merchant(rng) % handles.size()];
+        switch (i % 4) {
+        case 0: bank.tryDeposit(from, Money::fromCents(250)); break;
+        case 1: bank.tryWithdraw(from, Money::fromCents(100)); break;
+        default: bank.tryTransfer(from, to, Money::fromCents(175)); break;
+        }
+    }
+    double operationSeconds = secondsSince(start);
+    cout.rdbuf(console);
+
+    cout << "Comptes: " << accountCount << " Transactions: " << transactionCount
+        << " ops/s=" << (long long)(transactionCount / operationSeconds) << endl;
+
+    // Soldes: tri partiel de tous les comptes. Le premier appel au classement
+    // réordonne les comptes changés depuis le dernier; le second, aucun.
+    start = chrono::steady_clock::now();
+    vector<AccountHandle> sorted = sortedTop(bank, topCount);
+    double sortSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<RankedAccount> topBalances = bank.getTopBalances(topCount);
+    double rankingSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    bank.getTopBalances(topCount);
+    double cleanSeconds = secondsSince(start);
+
+    size_t n = sorted.size();
+    bool balancesOk = topBalances.size() == n;
+    for (size_t i = 0; balancesOk && i < n; i++) {
+        balancesOk = topBalances[i].handle == sorted[i];
+    }
+    cout << "soldes   tri=" << sortSeconds * 1e3 << "ms classement=" << rankingSeconds * 1e6
+        << "us puis=" << cleanSeconds * 1e6
+        << "us premier=" << (n > 0 ? topBalances[0].accountNumber : "-")
+        << " coherent=" << (balancesOk ? "oui" : "NON") << endl;
+
+    // Activité: longueur de chaque historique
+    start = chrono::steady_clock::now();
+    vector<int64_t> counts;
+    counts.reserve(handles.size());
+    for (AccountHandle handle : handles) {
+        counts.push_back((int64_t)bank.getAccountTransactions(handle).size());
+    }
+    size_t m = min(topCount, counts.size());
+    partial_sort(counts.begin(), counts.begin() + m, counts.end(), greater<int64_t>());
+    double scanSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<RankedAccount> mostActive = bank.getMostActiveAccounts(topCount);
+    rankingSeconds = secondsSince(start);
+
+    bool activityOk = mostActive.size() == min(m, Bank::ACTIVITY_RANKING_SIZE);
+    for (size_t i = 0; activityOk && i < mostActive.size(); i++) {
+        activityOk = mostActive[i].value == counts[i];
+    }
+    cout << "activite parcours=" << scanSeconds * 1e3 << "ms classement=" << rankingSeconds * 1e6
+        << "us premier=" << (mostActive.empty() ? 0 : mostActive[0].value) << " transactions"
+        << " coherent=" << (activityOk ? "oui" : "NON") << endl;
+
+    // Dépôts concurrents: la même banque, en mode multi-thread
+    bank.setThreadSafe(true);
+    unsigned maxThreads = max(2u, thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        concurrentDeposits(handles, bank, (int)threads, transactionCount, topCount);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+// bench_reconcile.cpp - rapprochement des soldes avec l'historique:
+// rejeu parallèle de toutes les transactions, partitionné par compte
+// Usage: bench_reconcile [transactions] [comptes] [threads max]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+int main(int argc, char* argv[]) {
+    long long transactionCount = argc > 1 ? atoll(argv[1]) : 10000000;
+    long long accountCount = argc > 2 ? atoll(argv[2]) : 1000000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+    if (accountCount < 2) accountCount = 2;
+
+    cout << "=== RAPPROCHEMENT DES SOLDES ===" << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque de rapprochement", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<AccountHandle> handles;
+    handles.reserve((size_t)accountCount);
+    for (long long i = 0; i < accountCount; i++) {
+        int clientId = bank.addClient("Prenom", "Nom", addr);
+        string number = bank.openAccount(clientId, AccountType::CHECKING, Money(1000.0));
+        handles.push_back(bank.getAccountHandle(number));
+    }
+
+    mt19937 rng(99);
+    uniform_int_distribution<size_t> pick(0, handles.size() - 1);
+    for (long long i = 0; i < transactionCount; i++) {
+        AccountHandle from = handles[pick(rng)];
+        AccountHandle to = handles[pick(rng)];
+        switch (i % 4) {
+        case 0: bank.tryDeposit(to, Money::fromCents(250)); break;
+        case 1: bank.tryWithdraw(from, Money::fromCents(100)); break;
+        default: bank.tryTransfer(from, to, Money::fromCents(175)); break;
+        }
+    }
+    cout.rdbuf(console);
+
+    // Un solde faussé hors de toute transaction: le rapprochement doit le trouver
+    BankAccount* damaged = bank.getAccount(handles[handles.size() / 2]);
+    damaged->restore(damaged->getBalance() + Money::fromCents(1), damaged->getStatus());
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        auto start = chrono::steady_clock::now();
+        ReconciliationReport report = bank.reconcile((unsigned)threads);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        cout << "threads=" << threads
+            << " transactions=" << report.transactions
+            << " comptes=" << report.accounts
+            << " temps=" << seconds << "s"
+            << " lignes/s=" << (long long)(report.transactions / seconds)
+            << " ecarts=" << report.mismatches.size();
+        if (!report.isConsistent()) {
+            const ReconciliationMismatch& first = report.mismatches.front();
+            cout << " (" << first.accountNumber << ": " << first.recorded
+                << " au lieu de " << first.expected << ")";
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
\ No newline at end of file
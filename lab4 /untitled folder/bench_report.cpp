@@ -0,0 +1,107 @@
+// bench_report.cpp - listes et relevés: affichage ligne à ligne
+// (displayAllAccounts) contre rapports CSV/JSON parallèles (ReportWriter)
+// Usage: bench_report [comptes] [threads max] [fichier de sortie]
+#include <iostream>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double timeRun(const string& filename, const function<void(ostream&)>& run, long long& bytes) {
+    ofstream file(filename, ios::binary | ios::trunc);
+    vector<char> fileBuffer(1 << 20);
+    file.rdbuf()->pubsetbuf(fileBuffer.data(), (streamsize)fileBuffer.size());
+
+    auto start = chrono::steady_clock::now();
+    run(file);
+    file.flush();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    bytes = (long long)file.tellp();
+    return seconds;
+}
+
+int main(int argc, char* argv[]) {
+    long long accountCount = argc > 1 ? atoll(argv[1]) : 1000000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    string filename = argc > 3 ? argv[3] : "bench_report.out";
+    if (maxThreads < 1) maxThreads = 1;
+
+    cout << "=== RAPPORTS CSV ET JSON ===" << endl;
+    cout << "Comptes: " << accountCount << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque de rapports", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<AccountHandle> handles;
+    handles.reserve((size_t)accountCount);
+    for (long long i = 0; i < accountCount; i++) {
+        int clientId = bank.addClient("Prenom", "Nom" + to_string(i % 1000), addr);
+        string number = bank.openAccount(clientId, AccountType::CHECKING, Money(100.0));
+        handles.push_back(bank.getAccountHandle(number));
+    }
+    // Quelques transactions par compte, pour les relevés
+    for (size_t i = 0; i < handles.size(); i++) {
+        bank.tryDeposit(handles[i], Money(12.34));
+        bank.tryTransfer(handles[i], handles[(i + 1) % handles.size()], Money(1.5));
+    }
+    cout.rdbuf(console);
+
+    long long bytes = 0;
+    double seconds = timeRun(filename, [&](ostream& out) {
+        streambuf* saved = cout.rdbuf(out.rdbuf());
+        bank.displayAllAccounts();
+        cout.rdbuf(saved);
+    }, bytes);
+    cout << "displayAllAccounts         temps=" << seconds << "s octets=" << bytes << endl;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    struct Report {
+        const char* name;
+        bool (Bank::*run)(ostream&, ReportFormat, unsigned) const;
+    };
+    const Report reports[] = {
+        { "exportAccounts", &Bank::exportAccounts },
+        { "exportStatements", &Bank::exportStatements },
+        { "exportTransactions", &Bank::exportTransactions },
+    };
+
+    for (const Report& report : reports) {
+        for (ReportFormat format : { ReportFormat::CSV, ReportFormat::JSON }) {
+            for (int threads : threadCounts) {
+                seconds = timeRun(filename, [&](ostream& out) {
+                    (bank.*report.run)(out, format, (unsigned)threads);
+                }, bytes);
+                cout << report.name << (format == ReportFormat::CSV ? " csv " : " json")
+                    << " threads=" << threads
+                    << " temps=" << seconds << "s"
+                    << " Mo/s=" << (long long)(bytes / seconds / 1e6)
+                    << " octets=" << bytes << endl;
+            }
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
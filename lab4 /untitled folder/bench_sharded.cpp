@@ -0,0 +1,116 @@
+// bench_sharded.cpp - transferts sur N shards (une banque par thread),
+// avec une part de transferts entre shards
+// Usage: bench_sharded [transferts] [comptes par shard] [shards max] [% inter-shards]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include "Address.h"
+#include "ShardedBank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: la banque écrit un message par ouverture de compte
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+struct RunResult {
+    double seconds;
+    long long succeeded;
+    bool conserved;
+};
+
+static RunResult runShards(size_t shardCount, long long totalTransfers, int accountsPerShard,
+    int crossPercent) {
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    ShardedBank bank(shardCount, "Banque de test");
+    vector<vector<AccountHandle>> handles(shardCount);
+    for (size_t s = 0; s < shardCount; s++) {
+        handles[s] = bank.call(s, [accountsPerShard](Bank& shard) {
+            Address addr("1 Rue du Test", "Paris", "75000", "France");
+            int clientId = shard.addClient("Test", "Shard", addr);
+            vector<AccountHandle> result;
+            for (int i = 0; i < accountsPerShard; i++) {
+                result.push_back(shard.getAccountHandle(
+                    shard.openAccount(clientId, AccountType::CHECKING, Money(1000.0))));
+            }
+            return result;
+        });
+    }
+    cout.rdbuf(console);
+    Money before = bank.getTotalBalance();
+
+    atomic<long long> succeeded{ 0 };
+    long long perProducer = totalTransfers / (long long)shardCount;
+    auto start = chrono::steady_clock::now();
+
+    // Un producteur par shard: les clients de cette banque
+    vector<thread> producers;
+    for (size_t s = 0; s < shardCount; s++) {
+        producers.emplace_back([&, s]() {
+            mt19937 rng(777 + (unsigned)s);
+            uniform_int_distribution<int> pickAccount(0, accountsPerShard - 1);
+            uniform_int_distribution<int> pickPercent(0, 99);
+            uniform_int_distribution<size_t> pickShard(0, shardCount - 1);
+            for (long long i = 0; i < perProducer; i++) {
+                size_t target = pickPercent(rng) < crossPercent ? pickShard(rng) : s;
+                ShardAccount from{ (uint32_t)s, handles[s][pickAccount(rng)] };
+                ShardAccount to{ (uint32_t)target, handles[target][pickAccount(rng)] };
+                bank.transfer(from, to, Money::fromCents(100), [&succeeded](OperationStatus status) {
+                    if (status == OperationStatus::OK) {
+                        succeeded.fetch_add(1, memory_order_relaxed);
+                    }
+                });
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    bank.quiesce();
+
+    auto end = chrono::steady_clock::now();
+    bool conserved = bank.getTotalBalance() == before;
+    return { chrono::duration<double>(end - start).count(), succeeded.load(), conserved };
+}
+
+int main(int argc, char* argv[]) {
+    long long totalTransfers = argc > 1 ? atoll(argv[1]) : 2000000;
+    int accountsPerShard = argc > 2 ? atoi(argv[2]) : 10000;
+    int maxShards = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+    int crossPercent = argc > 4 ? atoi(argv[4]) : 10;
+    if (maxShards < 1) maxShards = 1;
+    if (accountsPerShard < 2) accountsPerShard = 2;
+
+    cout << "=== TRANSFERTS SUR BANQUES SHARDEES ===" << endl;
+    cout << "Transferts: " << totalTransfers << ", comptes par shard: " << accountsPerShard
+        << ", inter-shards: " << crossPercent << "%" << endl;
+
+    vector<int> shardCounts;
+    for (int shards = 1; shards < maxShards; shards *= 2) {
+        shardCounts.push_back(shards);
+    }
+    shardCounts.push_back(maxShards);
+
+    for (int shards : shardCounts) {
+        RunResult result = runShards((size_t)shards, totalTransfers, accountsPerShard, crossPercent);
+        cout << "shards=" << shards
+            << " ops/s=" << (long long)(result.succeeded / result.seconds)
+            << " temps=" << result.seconds << "s"
+            << " reussis=" << result.succeeded
+            << " total=" << (result.conserved ? "conserve" : "FAUX") << endl;
+    }
+
+    return 0;
+}
\ No newline at end of file
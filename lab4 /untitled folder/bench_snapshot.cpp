@@ -0,0 +1,115 @@
+// bench_snapshot.cpp - instantané pris pendant des transferts concurrents:
+// durée du gel, de l'écriture en arrière-plan et du rechargement
+// Usage: bench_snapshot [comptes] [threads] [fichier]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: la banque écrit un message par ouverture de compte
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double millisecondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 200000;
+    int threadCount = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    string filename = argc > 3 ? argv[3] : "bench_snapshot.bin";
+    if (accountCount < 2) accountCount = 2;
+    if (threadCount < 1) threadCount = 1;
+
+    cout << "=== INSTANTANE PENDANT DES TRANSFERTS ===" << endl;
+    cout << "Comptes: " << accountCount << ", threads: " << threadCount << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque de test", "999");
+    bank.setThreadSafe(true);
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    int clientId = bank.addClient("Test", "Instantane", addr);
+
+    vector<AccountHandle> accountHandles;
+    accountHandles.reserve(accountCount);
+    for (int i = 0; i < accountCount; i++) {
+        string number = bank.openAccount(clientId, AccountType::CHECKING, Money(1000.0));
+        accountHandles.push_back(bank.getAccountHandle(number));
+    }
+    cout.rdbuf(console);
+
+    atomic<bool> stop{ false };
+    atomic<long long> transfers{ 0 };
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(4242 + t);
+            uniform_int_distribution<int> pick(0, accountCount - 1);
+            while (!stop.load(memory_order_relaxed)) {
+                int from = pick(rng);
+                int to = (from + 1 + pick(rng) % (accountCount - 1)) % accountCount;
+                if (bank.tryTransfer(accountHandles[from], accountHandles[to],
+                    Money::fromCents(1 + pick(rng) % 5000)) == OperationStatus::OK) {
+                    transfers.fetch_add(1, memory_order_relaxed);
+                }
+            }
+        });
+    }
+    this_thread::sleep_for(chrono::milliseconds(200));
+
+    auto start = chrono::steady_clock::now();
+    bool started = bank.startSnapshot(filename);
+    double freezeMs = millisecondsSince(start);
+    long long before = transfers.load();
+    bool written = started && bank.waitSnapshot();
+    double writeMs = millisecondsSince(start);
+    long long during = transfers.load() - before;
+
+    stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    cout << "gel=" << freezeMs << "ms ecriture=" << writeMs << "ms"
+        << " transferts pendant l'ecriture=" << during
+        << " ecrit=" << (written ? "oui" : "NON") << endl;
+
+    // Les transferts conservent le total: l'instantané cohérent aussi
+    start = chrono::steady_clock::now();
+    SnapshotFile snapshot;
+    bool mapped = snapshot.open(filename);
+    double mapMs = millisecondsSince(start);
+    int64_t totalCents = 0;
+    for (const SnapshotAccountRecord& record : snapshot.getAccounts()) {
+        totalCents += record.balanceCents;
+    }
+    bool consistent = mapped && totalCents == (int64_t)accountCount * 100000;
+
+    cout.rdbuf(&nullBuffer);
+    Bank restored;
+    start = chrono::steady_clock::now();
+    bool loaded = restored.loadSnapshot(filename);
+    double loadMs = millisecondsSince(start);
+    cout.rdbuf(console);
+
+    cout << "projection=" << mapMs << "ms total=" << (consistent ? "coherent" : "INCOHERENT")
+        << " rechargement=" << loadMs << "ms comptes=" << restored.getTotalAccounts()
+        << (loaded ? "" : " ECHEC") << endl;
+
+    return 0;
+}
\ No newline at end of file
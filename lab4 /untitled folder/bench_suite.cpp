@@ -0,0 +1,199 @@
+// bench_suite.cpp - opérations de Bank pour des populations de 1e3 à 1e7:
+// ns/op, allocations/op, p50 et p99 par opération
+// Usage: bench_suite [--max N] [--samples K] [--csv]
+//   --max      plus grande population (défaut 1000000, jusqu'à 10000000)
+//   --samples  opérations mesurées par population pour les recherches et
+//              opérations (défaut 100000)
+//   --csv      sortie CSV, une ligne par opération et population
+#include <iostream>
+#include <iomanip>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Compteur d'allocations: remplace l'opérateur new global du programme
+// (les allocations sur-alignées ne sont pas comptées)
+static atomic<long long> allocationCount{ 0 };
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* memory = malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+// Tampon qui jette tout: la banque écrit un message par opération
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+struct Measurement {
+    const char* operation;
+    size_t population;
+    size_t ops;
+    double nsPerOp;
+    double allocationsPerOp;
+    long long p50;
+    long long p99;
+};
+
+// Chaque opération est chronométrée seule; la durée inclut la lecture de l'horloge
+template <class Operation>
+static Measurement measure(const char* name, size_t population, size_t ops, Operation operation) {
+    vector<long long> samples(ops);
+    long long allocationsBefore = allocationCount.load(memory_order_relaxed);
+    auto start = chrono::steady_clock::now();
+
+    for (size_t i = 0; i < ops; i++) {
+        auto begin = chrono::steady_clock::now();
+        operation(i);
+        auto end = chrono::steady_clock::now();
+        samples[i] = chrono::duration_cast<chrono::nanoseconds>(end - begin).count();
+    }
+
+    double total = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    long long allocations = allocationCount.load(memory_order_relaxed) - allocationsBefore;
+
+    sort(samples.begin(), samples.end());
+    Measurement result;
+    result.operation = name;
+    result.population = population;
+    result.ops = ops;
+    result.nsPerOp = ops ? total / ops : 0.0;
+    result.allocationsPerOp = ops ? (double)allocations / ops : 0.0;
+    result.p50 = ops ? samples[ops / 2] : 0;
+    result.p99 = ops ? samples[min(ops - 1, ops * 99 / 100)] : 0;
+    return result;
+}
+
+static vector<Measurement> runPopulation(size_t population, size_t sampleCount) {
+    vector<Measurement> results;
+    size_t ops = min(population, sampleCount);
+
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    vector<string> lastNames;
+    for (int i = 0; i < 1000; i++) {
+        lastNames.push_back("Nom" + to_string(i));
+    }
+    vector<int> clientIds(population);
+    vector<string> accountNumbers(population);
+
+    mt19937 rng(4321);
+    uniform_int_distribution<size_t> pick(0, population - 1);
+    vector<size_t> first(ops);
+    vector<size_t> second(ops);
+    for (size_t i = 0; i < ops; i++) {
+        first[i] = pick(rng);
+        second[i] = pick(rng);
+        if (second[i] == first[i]) {
+            second[i] = (second[i] + 1) % population;
+        }
+    }
+
+    Bank bank("Banque de test", "999");
+
+    results.push_back(measure("addClient", population, population, [&](size_t i) {
+        clientIds[i] = bank.addClient("Prenom", lastNames[i % lastNames.size()], addr,
+            i % 10 == 0 ? ClientType::PREMIUM : ClientType::REGULAR);
+    }));
+    results.push_back(measure("openAccount", population, population, [&](size_t i) {
+        accountNumbers[i] = bank.openAccount(clientIds[i],
+            i % 2 == 0 ? AccountType::CHECKING : AccountType::SAVINGS, Money(1000.0));
+    }));
+    results.push_back(measure("findAccount", population, ops, [&](size_t i) {
+        bank.findAccount(accountNumbers[first[i]]);
+    }));
+    results.push_back(measure("deposit", population, ops, [&](size_t i) {
+        bank.deposit(accountNumbers[first[i]], Money(1.0));
+    }));
+    results.push_back(measure("transfer", population, ops, [&](size_t i) {
+        bank.transfer(accountNumbers[first[i]], accountNumbers[second[i]], Money(0.01));
+    }));
+    results.push_back(measure("getClientAccounts", population, ops, [&](size_t i) {
+        bank.getClientAccounts(clientIds[first[i]]);
+    }));
+    results.push_back(measure("displayAccountTransactions", population, ops, [&](size_t i) {
+        bank.displayAccountTransactions(accountNumbers[first[i]]);
+    }));
+    results.push_back(measure("getTotalBankBalance", population, ops, [&](size_t) {
+        bank.getTotalBankBalance();
+    }));
+    return results;
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxPopulation = 1000000;
+    size_t sampleCount = 100000;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+            maxPopulation = (size_t)atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            sampleCount = (size_t)atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        }
+    }
+    if (sampleCount < 1) sampleCount = 1;
+
+    if (csv) {
+        cout << "operation,population,ops,ns_per_op,allocs_per_op,p50_ns,p99_ns" << endl;
+    }
+    else {
+        cout << "=== SUITE DE MESURES DE BANK ===" << endl;
+        cout << "operation                  population        ops      ns/op  allocs/op    p50    p99" << endl;
+    }
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+
+    for (size_t population = 1000; population <= maxPopulation && population <= 10000000;
+        population *= 10) {
+        cout.rdbuf(&nullBuffer);
+        vector<Measurement> results = runPopulation(population, sampleCount);
+        cout.rdbuf(console);
+
+        for (const Measurement& m : results) {
+            if (csv) {
+                cout << m.operation << "," << m.population << "," << m.ops << ","
+                    << fixed << setprecision(1) << m.nsPerOp << ","
+                    << setprecision(3) << m.allocationsPerOp << ","
+                    << m.p50 << "," << m.p99 << endl;
+            }
+            else {
+                cout << left << setw(26) << m.operation << right
+                    << setw(11) << m.population
+                    << setw(11) << m.ops
+                    << setw(11) << fixed << setprecision(1) << m.nsPerOp
+                    << setw(11) << setprecision(2) << m.allocationsPerOp
+                    << setw(7) << m.p50
+                    << setw(7) << m.p99 << endl;
+            }
+        }
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+// bench_velocity.cpp - latence par opération des retraits et transferts,
+// sans puis avec limites de vélocité, percentile par percentile; puis
+// nombre de destinataires distincts acceptés avant refus, par limite
+// Usage: bench_velocity [opérations] [comptes]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout: la banque écrit un message par ouverture de compte
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static const double PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+
+// Latences en nanosecondes, triées
+static vector<long long> measure(bool limited, long long operations, int accountCount) {
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    Bank bank("Banque de test", "999");
+    bank.setThreadSafe(true);
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    int clientId = bank.addClient("Test", "Velocite", addr);
+    vector<AccountHandle> handles;
+    for (int i = 0; i < accountCount; i++) {
+        handles.push_back(bank.getAccountHandle(
+            bank.openAccount(clientId, AccountType::CHECKING, Money(1000000.0))));
+    }
+    cout.rdbuf(console);
+
+    if (limited) {
+        // Limites assez hautes pour que les opérations passent: on mesure le coût
+        VelocityLimits limits;
+        limits.windowSeconds = 600;
+        limits.maxDebits = 1000000;
+        limits.maxDebitTotal = Money(100000000.0);
+        limits.maxCounterpartiesPerHour = 200;
+        bank.setVelocityLimits(limits);
+    }
+
+    mt19937 rng(99);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    vector<long long> latencies;
+    latencies.reserve(operations);
+    for (long long i = 0; i < operations; i++) {
+        AccountHandle from = handles[pick(rng)];
+        AccountHandle to = handles[pick(rng)];
+        auto start = chrono::steady_clock::now();
+        if (i % 2 == 0 || from == to) {
+            bank.tryWithdraw(from, Money::fromCents(1));
+        }
+        else {
+            bank.tryTransfer(from, to, Money::fromCents(1));
+        }
+        auto end = chrono::steady_clock::now();
+        latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+    }
+    sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+// Vérification et enregistrement seuls, hors banque et verrous
+static vector<long long> measureGuard(long long operations, int accountCount) {
+    VelocityLimits limits;
+    limits.windowSeconds = 600;
+    limits.maxDebits = 1000000;
+    limits.maxDebitTotal = Money(100000000.0);
+    limits.maxCounterpartiesPerHour = 200;
+    VelocityGuard guard;
+    guard.configure(limits);
+    for (int i = 0; i < accountCount; i++) {
+        guard.addAccount((AccountHandle)i);
+    }
+
+    mt19937 rng(99);
+    uniform_int_distribution<int> pick(0, accountCount - 1);
+    vector<long long> latencies;
+    latencies.reserve(operations);
+    for (long long i = 0; i < operations; i++) {
+        AccountHandle from = (AccountHandle)pick(rng);
+        AccountHandle to = i % 2 == 0 ? NO_ACCOUNT : (AccountHandle)pick(rng);
+        auto start = chrono::steady_clock::now();
+        int64_t now = VelocityGuard::currentTime();
+        if (guard.check(from, to, Money::fromCents(1), now) == OperationStatus::OK) {
+            guard.record(from, to, Money::fromCents(1), now);
+        }
+        auto end = chrono::steady_clock::now();
+        latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+    }
+    sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+// Transferts d'un même compte vers des destinataires tous différents,
+// jusqu'au premier refus (0 si jamais refusé)
+static int acceptedCounterparties(int limit) {
+    VelocityLimits limits;
+    limits.maxCounterpartiesPerHour = limit;
+    VelocityGuard guard;
+    guard.configure(limits);
+    guard.addAccount(0);
+
+    int64_t now = VelocityGuard::currentTime();
+    for (AccountHandle peer = 1; peer <= 100000; peer++) {
+        if (guard.check(0, peer, Money::fromCents(1), now) != OperationStatus::OK) {
+            return (int)peer - 1;
+        }
+        guard.record(0, peer, Money::fromCents(1), now);
+    }
+    return 0;
+}
+
+static long long percentile(const vector<long long>& sorted, double p) {
+    size_t index = (size_t)(p / 100.0 * (sorted.size() - 1));
+    return sorted[index];
+}
+
+int main(int argc, char* argv[]) {
+    long long operations = argc > 1 ? atoll(argv[1]) : 1000000;
+    int accountCount = argc > 2 ? atoi(argv[2]) : 10000;
+    if (operations < 1) operations = 1;
+    if (accountCount < 2) accountCount = 2;
+
+    cout << "=== LATENCE DES LIMITES DE VELOCITE ===" << endl;
+    cout << "Operations: " << operations << ", comptes: " << accountCount << endl;
+
+    vector<long long> plain = measure(false, operations, accountCount);
+    vector<long long> limited = measure(true, operations, accountCount);
+    vector<long long> guardOnly = measureGuard(operations, accountCount);
+
+    // garde = horloge + check + record seuls, mesure comprise
+    cout << "percentile  sans(ns)  avec(ns)  ajout(ns)  garde(ns)" << endl;
+    for (double p : PERCENTILES) {
+        long long a = percentile(plain, p);
+        long long b = percentile(limited, p);
+        cout << "p" << p << "  " << a << "  " << b << "  " << (b - a)
+            << "  " << percentile(guardOnly, p) << endl;
+    }
+
+    // Au-delà du plafond, la limite effective est le plafond
+    cout << "limite  effective  acceptes  refuse" << endl;
+    for (int limit : { 10, 50, 200, 500, 1000, 5000 }) {
+        int effective = min(limit, VelocityGuard::MAX_COUNTERPARTIES_PER_HOUR);
+        int accepted = acceptedCounterparties(limit);
+        cout << limit << "  " << effective << "  " << accepted << "  "
+            << (accepted > 0 ? "oui" : "NON") << endl;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+// bench_views.cpp - vues filtrées (getAccountsView, getClientsView,
+// getClientAccountsView avec filters::) contre une copie complète
+// (getAllAccounts, getAllClients) filtrée à la main
+// Usage: bench_views [comptes] [répétitions]
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "Address.h"
+#include "Bank.h"
+
+using namespace std;
+
+// Tampon qui jette tout, pour la construction de la banque
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Compare la vue filtrée à la copie filtrée par expected, et les chronomètre
+template <class View, class Expected>
+static void checkAccounts(const char* name, const Bank& bank, View view, Expected expected,
+    int repeats) {
+    auto start = chrono::steady_clock::now();
+    vector<string> scanned;
+    for (int r = 0; r < repeats; r++) {
+        scanned.clear();
+        for (const auto& account : bank.getAllAccounts()) {
+            if (expected(*account)) {
+                scanned.push_back(account->getAccountNumber());
+            }
+        }
+    }
+    double scanSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<string> viewed;
+    for (int r = 0; r < repeats; r++) {
+        viewed.clear();
+        for (const BankAccount* account : view()) {
+            viewed.push_back(account->getAccountNumber());
+        }
+    }
+    double viewSeconds = secondsSince(start);
+
+    cout << name << " lignes=" << viewed.size()
+        << " copie=" << scanSeconds / repeats * 1e3 << "ms"
+        << " vue=" << viewSeconds / repeats * 1e3 << "ms"
+        << " acceleration=x" << scanSeconds / viewSeconds
+        << " coherent=" << (viewed == scanned ? "oui" : "NON") << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int accountCount = argc > 1 ? atoi(argv[1]) : 200000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    if (accountCount < 2) accountCount = 2;
+    if (repeats < 1) repeats = 1;
+
+    cout << "=== VUES FILTREES ===" << endl;
+    cout << "Comptes: " << accountCount << " Repetitions: " << repeats << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* console = cout.rdbuf();
+    cout.rdbuf(&nullBuffer);
+
+    // Deux comptes par client, un client sur cinq premium; soldes variés,
+    // quelques comptes gelés ou fermés
+    Bank bank("Banque des vues", "001");
+    Address addr("1 Rue du Test", "Paris", "75000", "France");
+    mt19937 rng(23);
+    vector<int> clientIds;
+    for (int i = 0; i < accountCount; i++) {
+        if (i % 2 == 0) {
+            clientIds.push_back(bank.addClient("Prenom", "Nom", addr,
+                i % 10 == 0 ? ClientType::PREMIUM : ClientType::REGULAR));
+        }
+        AccountType type = rng() % 3 == 0 ? AccountType::SAVINGS : AccountType::CHECKING;
+        string number = bank.openAccount(clientIds.back(), type, Money::fromCents(rng() % 50000));
+        if (i % 50 == 1) {
+            bank.tryFreezeAccount(bank.getAccountHandle(number));
+        }
+        else if (i % 97 == 3) {
+            bank.tryWithdraw(bank.getAccountHandle(number), bank.getAccount(number)->getBalance());
+            bank.closeAccount(number);
+        }
+    }
+    cout.rdbuf(console);
+
+    checkAccounts("epargne&&solde>=100", bank,
+        [&] { return bank.getAccountsView(filters::accountType(AccountType::SAVINGS)
+            && filters::minBalance(Money(100.0))); },
+        [](const BankAccount& a) {
+            return a.getType() == AccountType::SAVINGS && a.getBalance() >= Money(100.0);
+        }, repeats);
+    checkAccounts("gele||solde<10", bank,
+        [&] { return bank.getAccountsView(filters::accountStatus(AccountStatus::FROZEN)
+            || filters::maxBalance(Money(10.0))); },
+        [](const BankAccount& a) {
+            return a.getStatus() == AccountStatus::FROZEN || a.getBalance() < Money(10.0);
+        }, repeats);
+    checkAccounts("!courant&&!ferme", bank,
+        [&] { return bank.getAccountsView(!filters::accountType(AccountType::CHECKING)
+            && !filters::accountStatus(AccountStatus::CLOSED)); },
+        [](const BankAccount& a) {
+            return a.getType() != AccountType::CHECKING && a.getStatus() != AccountStatus::CLOSED;
+        }, repeats);
+
+    // Un client: sa vue contre la copie de tous les comptes filtrée par titulaire
+    int owner = clientIds[clientIds.size() / 2];
+    checkAccounts("client&&actif", bank,
+        [&] { return bank.getClientAccountsView(owner,
+            filters::accountStatus(AccountStatus::ACTIVE)); },
+        [owner](const BankAccount& a) {
+            return a.getClientId() == owner && a.getStatus() == AccountStatus::ACTIVE;
+        }, repeats);
+
+    // Clients premium
+    auto start = chrono::steady_clock::now();
+    vector<int> scanned;
+    for (int r = 0; r < repeats; r++) {
+        scanned.clear();
+        for (const auto& client : bank.getAllClients()) {
+            if (client->getType() == ClientType::PREMIUM) {
+                scanned.push_back(client->getId());
+            }
+        }
+    }
+    double scanSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<int> viewed;
+    for (int r = 0; r < repeats; r++) {
+        viewed.clear();
+        for (const Client* client : bank.getClientsView(filters::clientType(ClientType::PREMIUM))) {
+            viewed.push_back(client->getId());
+        }
+    }
+    double viewSeconds = secondsSince(start);
+
+    cout << "clients premium lignes=" << viewed.size()
+        << " copie=" << scanSeconds / repeats * 1e3 << "ms"
+        << " vue=" << viewSeconds / repeats * 1e3 << "ms"
+        << " acceleration=x" << scanSeconds / viewSeconds
+        << " coherent=" << (viewed == scanned ? "oui" : "NON") << endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -22,7 +22,7 @@ int main() {
     cout << "Client ajoute avec ID: " << clientId << endl;
 
     // Test 4 : Compte
-    string compte = bank.openAccount(clientId, AccountType::CHECKING, 1000.0);
+    string compte = bank.openAccount(clientId, AccountType::CHECKING, Money(1000.0));
     if (!compte.empty()) {
         cout << "Compte ouvert: " << compte << endl;
     }